@@ -1,4 +1,5 @@
 #include "Agave.hpp"
+#include "dsp/LookupTables.hpp"
 
 
 // The plugin-wide instance of the Plugin class
@@ -10,11 +11,18 @@ void init(rack::Plugin *p) {
 	// Add modules here
 	// p->addModel(modelTestEngine);
 	p->addModel(modelLowpassFilterBank);
+	p->addModel(modelLowpassFilterBankExpander);
 	p->addModel(modelSharpWavefolder);
 	p->addModel(modelMetallicNoise);
 	p->addModel(modelMS20VCF);
+	p->addModel(modelMS20HPF);
     p->addModel(modelBlank);
 
 	// Any other plugin initialization may go here.
 	// As an alternative, consider lazy-loading assets and lookup tables when your module is created to reduce startup times of Rack.
+
+	// Build shared lookup tables up front, so neither the first module instance nor the first
+	// process() using a table (the Spline tanh is built inside process()) pays for them
+	LookupTables::diodeKernel();
+	LookupTables::tanhKernel();
 }
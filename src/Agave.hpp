@@ -9,7 +9,9 @@ extern Plugin *pluginInstance;
 // Declare each Model, defined in each module source file
 // extern Model* modelTestEngine;
 extern Model* modelLowpassFilterBank;
+extern Model* modelLowpassFilterBankExpander;
 extern Model* modelSharpWavefolder;
 extern Model* modelMetallicNoise;
 extern Model* modelMS20VCF;
+extern Model* modelMS20HPF;
 extern Model* modelBlank;
@@ -101,6 +101,80 @@ struct ScrewDark : rack::SvgScrew {
     }
 };
 
+// DISPLAYS
+// Square X-Y plot over [-range, range] on both axes: a curve (e.g. a static transfer
+// function) with the most recent measured points on top, older points fading out.
+// Subclasses fill curve and call addPoint() from step(), on the UI thread
+struct XYDisplay : rack::TransparentWidget {
+    static constexpr int maxPoints = 128;
+    float range = 5.0f;
+    std::vector<Vec> curve;
+
+    Vec points[maxPoints];
+    int numPoints = 0;
+    int newestPoint = -1;
+
+    void addPoint(Vec p) {
+        newestPoint = (newestPoint + 1) % maxPoints;
+        points[newestPoint] = p;
+        if (numPoints < maxPoints)
+            numPoints++;
+    }
+
+    Vec toScreen(Vec p) const {
+        const float x = rescale(clamp(p.x, -range, range), -range, range, 0.0f, box.size.x);
+        const float y = rescale(clamp(p.y, -range, range), -range, range, box.size.y, 0.0f);
+        return Vec(x, y);
+    }
+
+    void draw(const DrawArgs& args) override {
+        NVGcontext* vg = args.vg;
+
+        // Background and axes
+        nvgBeginPath(vg);
+        nvgRoundedRect(vg, 0.0f, 0.0f, box.size.x, box.size.y, 3.0f);
+        nvgFillColor(vg, nvgRGB(0x20, 0x20, 0x20));
+        nvgFill(vg);
+
+        nvgBeginPath(vg);
+        nvgMoveTo(vg, 0.5f * box.size.x, 0.0f);
+        nvgLineTo(vg, 0.5f * box.size.x, box.size.y);
+        nvgMoveTo(vg, 0.0f, 0.5f * box.size.y);
+        nvgLineTo(vg, box.size.x, 0.5f * box.size.y);
+        nvgStrokeColor(vg, nvgRGB(0x50, 0x50, 0x50));
+        nvgStrokeWidth(vg, 1.0f);
+        nvgStroke(vg);
+
+        nvgSave(vg);
+        nvgScissor(vg, 0.0f, 0.0f, box.size.x, box.size.y);
+
+        if (curve.size() > 1) {
+            nvgBeginPath(vg);
+            Vec p = toScreen(curve[0]);
+            nvgMoveTo(vg, p.x, p.y);
+            for (size_t i = 1; i < curve.size(); i++) {
+                p = toScreen(curve[i]);
+                nvgLineTo(vg, p.x, p.y);
+            }
+            nvgStrokeColor(vg, nvgRGB(0x9a, 0x9a, 0x9a));
+            nvgStrokeWidth(vg, 1.0f);
+            nvgStroke(vg);
+        }
+
+        // Oldest first, so the newest points are drawn on top
+        for (int i = numPoints - 1; i >= 0; i--) {
+            const Vec p = toScreen(points[(newestPoint - i + maxPoints) % maxPoints]);
+            const float age = (float) i / maxPoints;
+            nvgBeginPath(vg);
+            nvgCircle(vg, p.x, p.y, 1.5f);
+            nvgFillColor(vg, nvgRGBA(0xff, 0x9b, 0x30, (unsigned char) (255.0f * (1.0f - age))));
+            nvgFill(vg);
+        }
+
+        nvgRestore(vg);
+    }
+};
+
 template<typename SCREW>
 inline void createScrews(rack::ModuleWidget& widget) {
     const auto width = widget.box.size.x;
@@ -6,11 +6,33 @@
 // CODED BY F. ESQUEDA - JANUARY 2018
 #include <iostream>
 #include <array>
+#include <atomic>
+#include <algorithm>
 
 #include "Agave.hpp"
-#include "dsp/Filters.hpp"
+#include "dsp/FiltersSIMD.hpp"
 #include "Components.hpp"
 
+using simd::float_4;
+
+namespace {
+    // Bands of the log-spaced and custom layouts. The "All bands" output carries one band per
+    // channel, so it has the lowest PORT_MAX_CHANNELS of them; the expander has all of them
+    constexpr int maxBands = 32;
+
+    // Range of the log-spaced layouts, in Hz
+    constexpr float lowestCutoff = 50.0f;
+    constexpr float highestCutoff = 10.0e3f;
+
+    // From the filter bank to the expander on its right, every sample
+    struct LowpassFilterBankMessage {
+        float input[PORT_MAX_CHANNELS] = {};
+        int channels = 0;
+        float cutoffs[maxBands] = {};
+        int bands = 0;
+    };
+}
+
 struct LowpassFilterBank : Module {
     enum ParamIds {
         NUM_PARAMS
@@ -26,20 +48,51 @@ struct LowpassFilterBank : Module {
         FILTER_692_OUTPUT,
         FILTER_1411_OUTPUT,
         FILTER_HIGH_OUTPUT,
+        ALL_BANDS_OUTPUT,
         NUM_OUTPUTS
     };
+    // The fixed outputs, one per band
+    static const int NUM_BANDS = FILTER_HIGH_OUTPUT + 1;
     enum LightIds {
         NUM_LIGHTS
     };
+    enum BandLayout {
+        LAYOUT_FIXED,
+        LAYOUT_LOG_8,
+        LAYOUT_LOG_12,
+        LAYOUT_LOG_16,
+        LAYOUT_LOG_24,
+        LAYOUT_LOG_32,
+        LAYOUT_CUSTOM,
+        NUM_LAYOUTS
+    };
 
+    // Polyphony is processed four voices at a time
     static const int MAX_POLY = 16;
+    static const int NUM_GROUPS = MAX_POLY / 4;
     float sampleRate = APP->engine->getSampleRate();
 
-    // Declare array of filters for each polyphonic channel
-    std::array<RCFilter, NUM_OUTPUTS> filters[MAX_POLY];
+    // One bank of NUM_BANDS filters for each group of four channels
+    RCFilterBankSIMD<NUM_BANDS> filters[NUM_GROUPS];
 
     // In Hz
-    std::array<float, NUM_OUTPUTS> cutoffFrequencies = {{78.0f, 198.0f, 373.0f, 692.0f, 1411.0f, 3.0e3f}};
+    std::array<float, NUM_BANDS> cutoffFrequencies = {{78.0f, 198.0f, 373.0f, 692.0f, 1411.0f, 3.0e3f}};
+
+    // Bands of the first input channel for the "All bands" output, laid out as chosen in the
+    // context menu (saved with the patch). The bank is resized at the start of the next
+    // process() call, never per sample. The custom table is entered in the context menu,
+    // which bumps customVersion once the table is written
+    RCFilterBandsSIMD<PORT_MAX_CHANNELS> allBands;
+    int bandLayout = LAYOUT_FIXED;
+    int activeBandLayout = -1;
+    std::array<float, maxBands> customCutoffs = {};
+    int numCustomCutoffs = 0;
+    std::atomic<int> customVersion{0};
+    int activeCustomVersion = 0;
+
+    // The layout in use, also sent to the expander
+    std::array<float, maxBands> cutoffs = {};
+    int bands = 0;
 
     LowpassFilterBank() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -51,65 +104,171 @@ struct LowpassFilterBank : Module {
         configOutput(FILTER_692_OUTPUT, "692 Hz");
         configOutput(FILTER_1411_OUTPUT, "1411 Hz");
         configOutput(FILTER_HIGH_OUTPUT, "High frequency");
+        configOutput(ALL_BANDS_OUTPUT, "All bands (first channel)");
         
         // Initialize filters for all channels
-        for (int c = 0; c < MAX_POLY; c++) {
-            auto *fc = begin(cutoffFrequencies);
-            for (auto &filter : filters[c]) {
-                filter = RCFilter(*fc, sampleRate);
-                if (fc != end(cutoffFrequencies))
-                    ++fc;
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setCutoffs(cutoffFrequencies.data(), NUM_BANDS, sampleRate);
+    }
+
+    void setBandLayout() {
+        activeCustomVersion = customVersion.load();
+        bands = NUM_BANDS;
+        int layout = bandLayout;
+        if (layout == LAYOUT_CUSTOM && numCustomCutoffs == 0)
+            layout = LAYOUT_FIXED;
+
+        switch (layout) {
+            case LAYOUT_LOG_8: bands = 8; break;
+            case LAYOUT_LOG_12: bands = 12; break;
+            case LAYOUT_LOG_16: bands = 16; break;
+            case LAYOUT_LOG_24: bands = 24; break;
+            case LAYOUT_LOG_32: bands = 32; break;
+            case LAYOUT_CUSTOM: bands = numCustomCutoffs; break;
+            default: break;
+        }
+
+        if (layout == LAYOUT_CUSTOM)
+            cutoffs = customCutoffs;
+        else if (layout == LAYOUT_FIXED)
+            std::copy(cutoffFrequencies.begin(), cutoffFrequencies.end(), cutoffs.begin());
+        else
+            for (int i = 0; i < bands; i++)
+                cutoffs[i] = lowestCutoff * std::pow(highestCutoff / lowestCutoff, (float) i / (bands - 1));
+
+        allBands.setCutoffs(cutoffs.data(), bands, sampleRate);
+        allBands.reset();
+        activeBandLayout = bandLayout;
+    }
+
+    // Cutoffs in Hz separated by commas or spaces, from the context menu. Anything that is
+    // not a number is skipped, and an empty table falls back to the fixed layout
+    void setCustomCutoffs(const std::string& text) {
+        std::array<float, maxBands> table;
+        int size = 0;
+        const char* s = text.c_str();
+        while (*s && size < maxBands) {
+            char* end;
+            const float fc = std::strtof(s, &end);
+            if (end == s) {
+                s++;
+                continue;
             }
+            table[size++] = clamp(fc, 1.0f, 20.0e3f);
+            s = end;
         }
+
+        customCutoffs = table;
+        numCustomCutoffs = size;
+        bandLayout = LAYOUT_CUSTOM;
+        customVersion++;
     }
 
     void process(const ProcessArgs& args) override {
         // Get number of polyphonic channels from input
         int channels = inputs[SIGNAL_INPUT].getChannels();
 
-        // Process each channel
-        for (int c = 0; c < channels; c++) {
-            // Read input sample for this channel
-            float input = inputs[SIGNAL_INPUT].getPolyVoltage(c);
-
-            // Send input to all filters for this channel
-            int idx = 0;
-            for (auto &filter : filters[c]) {
-                filter.process(input);
-                outputs[idx].setVoltage(filter.getLowpassOutput(), c);
-                if (idx != NUM_OUTPUTS)
-                    ++idx;
-            }
+        // Process four channels at a time
+        for (int c = 0; c < channels; c += 4) {
+            int g = c / 4;
+
+            // Send input to all filters for these channels
+            filters[g].process(inputs[SIGNAL_INPUT].getVoltageSimd<float_4>(c));
+            for (int i = 0; i < NUM_BANDS; i++)
+                outputs[i].setVoltageSimd(filters[g].getLowpassOutput(i), c);
         }
 
         // Set number of polyphonic channels for all outputs
-        for (int i = 0; i < NUM_OUTPUTS; i++) {
+        for (int i = 0; i < NUM_BANDS; i++) {
             outputs[i].setChannels(channels);
         }
+
+        // Four bands at a time, only while patched
+        if (bandLayout != activeBandLayout || customVersion.load() != activeCustomVersion)
+            setBandLayout();
+        if (outputs[ALL_BANDS_OUTPUT].isConnected() && channels > 0) {
+            const int allChannels = allBands.getBands();
+            outputs[ALL_BANDS_OUTPUT].setChannels(allChannels);
+            allBands.process(inputs[SIGNAL_INPUT].getVoltage(0));
+            for (int t = 0; t < allChannels; t += 4)
+                outputs[ALL_BANDS_OUTPUT].setVoltageSimd(allBands.getLowpassOutputs(t / 4), t);
+        }
+        else {
+            outputs[ALL_BANDS_OUTPUT].setChannels(0);
+        }
+
+        // The expander filters every channel itself, one sample later
+        if (rightExpander.module && rightExpander.module->model == modelLowpassFilterBankExpander) {
+            LowpassFilterBankMessage* message = (LowpassFilterBankMessage*) rightExpander.module->leftExpander.producerMessage;
+            message->channels = channels;
+            std::copy(inputs[SIGNAL_INPUT].getVoltages(), inputs[SIGNAL_INPUT].getVoltages() + channels, message->input);
+            message->bands = bands;
+            std::copy(cutoffs.begin(), cutoffs.begin() + bands, message->cutoffs);
+            rightExpander.module->leftExpander.requestMessageFlip();
+        }
     }
 
-    void onSampleRateChange() override {
-        for (int c = 0; c < MAX_POLY; c++) {
-            for (auto &filter : filters[c]) {
-                filter.setSampleRate(APP->engine->getSampleRate());
-            }
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "bandLayout", json_integer(bandLayout));
+        if (numCustomCutoffs > 0) {
+            json_t* cutoffsJ = json_array();
+            for (int i = 0; i < numCustomCutoffs; i++)
+                json_array_append_new(cutoffsJ, json_real(customCutoffs[i]));
+            json_object_set_new(rootJ, "customCutoffs", cutoffsJ);
         }
+        return rootJ;
     }
 
-    void onReset() override {
-        for (int c = 0; c < MAX_POLY; c++) {
-            auto *fc = begin(cutoffFrequencies);
-            for (auto &filter : filters[c]) {
-                filter = RCFilter(*fc, sampleRate);
-                if (fc != end(cutoffFrequencies))
-                    ++fc;
-            }
+    void dataFromJson(json_t* rootJ) override {
+        json_t* bandLayoutJ = json_object_get(rootJ, "bandLayout");
+        if (bandLayoutJ)
+            bandLayout = clamp((int) json_integer_value(bandLayoutJ), 0, NUM_LAYOUTS - 1);
+
+        // Cutoffs in Hz, one per band, kept between 1 Hz and 20 kHz
+        json_t* cutoffsJ = json_object_get(rootJ, "customCutoffs");
+        if (cutoffsJ) {
+            numCustomCutoffs = std::min((int) json_array_size(cutoffsJ), maxBands);
+            for (int i = 0; i < numCustomCutoffs; i++)
+                customCutoffs[i] = clamp((float) json_number_value(json_array_get(cutoffsJ, i)), 1.0f, 20.0e3f);
         }
+
+        // Rebuild the bank even if the layout is the same, the table may have changed
+        customVersion++;
+    }
+
+    void onSampleRateChange() override {
+        sampleRate = APP->engine->getSampleRate();
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setSampleRate(sampleRate);
+        allBands.setSampleRate(sampleRate);
+    }
+
+    void onReset() override {
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].reset();
+        allBands.reset();
     }
 };
 
 namespace Comps = AgaveComponents;
 
+// Custom table entry for the context menu, applied with Enter
+struct CutoffTableField : ui::TextField {
+    LowpassFilterBank* module = nullptr;
+
+    CutoffTableField() {
+        placeholder = "e.g. 100, 250, 600, 1500, 4000";
+    }
+
+    void onAction(const ActionEvent& e) override {
+        module->setCustomCutoffs(text);
+        ui::MenuOverlay* overlay = getAncestorOfType<ui::MenuOverlay>();
+        if (overlay)
+            overlay->requestDelete();
+    }
+};
+
 struct LowpassFilterBankWidget : ModuleWidget {
     LowpassFilterBankWidget(LowpassFilterBank* module) {
         setModule(module);
@@ -121,13 +280,147 @@ struct LowpassFilterBankWidget : ModuleWidget {
         addInput(createInputCentered<Comps::InputPort>(mm2px(Vec(10.16, 22.5)), module, LowpassFilterBank::SIGNAL_INPUT));
 
         // FILTERED OUTPUTS
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 40.0)), module, LowpassFilterBank::FILTER_LOW_OUTPUT));
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 52.5)), module, LowpassFilterBank::FILTER_198_OUTPUT));
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 65.0)), module, LowpassFilterBank::FILTER_373_OUTPUT));
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 77.5)), module, LowpassFilterBank::FILTER_692_OUTPUT));
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 90.0)), module, LowpassFilterBank::FILTER_1411_OUTPUT));
-        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 102.5)), module, LowpassFilterBank::FILTER_HIGH_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 37.5)), module, LowpassFilterBank::FILTER_LOW_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 50.0)), module, LowpassFilterBank::FILTER_198_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 62.5)), module, LowpassFilterBank::FILTER_373_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 75.0)), module, LowpassFilterBank::FILTER_692_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 87.5)), module, LowpassFilterBank::FILTER_1411_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 100.0)), module, LowpassFilterBank::FILTER_HIGH_OUTPUT));
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 112.5)), module, LowpassFilterBank::ALL_BANDS_OUTPUT));
+    }
+
+    void appendContextMenu(Menu* menu) override {
+        LowpassFilterBank* module = dynamic_cast<LowpassFilterBank*>(this->module);
+        if (!module)
+            return;
+
+        std::vector<std::string> layouts = {
+            "6 bands (same as the outputs)",
+            "8 bands, log-spaced",
+            "12 bands, log-spaced",
+            "16 bands, log-spaced",
+            "24 bands, log-spaced",
+            "32 bands, log-spaced"
+        };
+        if (module->numCustomCutoffs > 0)
+            layouts.push_back(string::f("%d bands, custom table", module->numCustomCutoffs));
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createIndexPtrSubmenuItem("Band layout", layouts, &module->bandLayout));
+
+        menu->addChild(createSubmenuItem("Custom table", "", [=](Menu* menu) {
+            menu->addChild(createMenuLabel(string::f("Up to %d cutoffs in Hz, then Enter", maxBands)));
+            CutoffTableField* field = new CutoffTableField;
+            field->box.size.x = 250.0f;
+            field->module = module;
+            // Starts from the bands in use, ready to edit
+            for (int i = 0; i < module->bands; i++)
+                field->text += string::f(i ? ", %g" : "%g", module->cutoffs[i]);
+            menu->addChild(field);
+        }));
+    }
+};
+
+// Expander: every band of every voice, one polyphonic output per band, for the bank on its
+// left. Bands past the layout's last are unpatched (no channels)
+struct LowpassFilterBankExpander : Module {
+    enum ParamIds {
+        NUM_PARAMS
+    };
+    enum InputIds {
+        NUM_INPUTS
+    };
+    enum OutputIds {
+        ENUMS(BAND_OUTPUT, maxBands),
+        NUM_OUTPUTS
+    };
+    enum LightIds {
+        NUM_LIGHTS
+    };
+
+    // Named after its cutoff
+    struct BandInfo : engine::PortInfo {
+        std::string getName() override {
+            LowpassFilterBankExpander* expander = static_cast<LowpassFilterBankExpander*>(module);
+            if (portId < expander->bands)
+                return string::f("Band %d (%g Hz)", portId + 1, expander->cutoffs[portId]);
+            return string::f("Band %d", portId + 1);
+        }
+    };
+
+    static const int MAX_POLY = 16;
+    static const int NUM_GROUPS = MAX_POLY / 4;
+    float sampleRate = APP->engine->getSampleRate();
+
+    RCFilterBankSIMD<maxBands> filters[NUM_GROUPS];
+    std::array<float, maxBands> cutoffs = {};
+    int bands = 0;
+
+    LowpassFilterBankMessage messages[2];
+
+    LowpassFilterBankExpander() {
+        config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
+
+        for (int i = 0; i < maxBands; i++)
+            configOutput<BandInfo>(BAND_OUTPUT + i);
+
+        leftExpander.producerMessage = &messages[0];
+        leftExpander.consumerMessage = &messages[1];
+    }
+
+    void setCutoffs(const LowpassFilterBankMessage* message) {
+        bands = message->bands;
+        std::copy(message->cutoffs, message->cutoffs + bands, cutoffs.begin());
+        for (int g = 0; g < NUM_GROUPS; g++) {
+            filters[g].setCutoffs(cutoffs.data(), bands, sampleRate);
+            filters[g].reset();
+        }
+    }
+
+    void process(const ProcessArgs& args) override {
+        int channels = 0;
+        if (leftExpander.module && leftExpander.module->model == modelLowpassFilterBank) {
+            const LowpassFilterBankMessage* message = (const LowpassFilterBankMessage*) leftExpander.consumerMessage;
+            if (message->bands != bands || !std::equal(cutoffs.begin(), cutoffs.begin() + bands, message->cutoffs))
+                setCutoffs(message);
+
+            channels = message->channels;
+            for (int c = 0; c < channels; c += 4) {
+                int g = c / 4;
+                filters[g].process(float_4::load(&message->input[c]));
+                for (int i = 0; i < bands; i++)
+                    outputs[BAND_OUTPUT + i].setVoltageSimd(filters[g].getLowpassOutput(i), c);
+            }
+        }
+
+        for (int i = 0; i < maxBands; i++)
+            outputs[BAND_OUTPUT + i].setChannels((i < bands) ? channels : 0);
+    }
+
+    void onSampleRateChange() override {
+        sampleRate = APP->engine->getSampleRate();
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setSampleRate(sampleRate);
+    }
+
+    void onReset() override {
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].reset();
+    }
+};
+
+struct LowpassFilterBankExpanderWidget : ModuleWidget {
+    LowpassFilterBankExpanderWidget(LowpassFilterBankExpander* module) {
+        setModule(module);
+        setPanel(createPanel(asset::plugin(pluginInstance, "res/LPFBankExpander.svg")));
+
+        Comps::createScrews<Comps::ScrewMetal>(*this);
+
+        // BAND OUTPUTS, LOWEST BAND AT THE TOP LEFT, EIGHT PER COLUMN
+        for (int i = 0; i < maxBands; i++)
+            addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(7.62 + 10.16 * (i / 8), 22.5 + 12.5 * (i % 8))), module, LowpassFilterBankExpander::BAND_OUTPUT + i));
     }
 };
 
 Model* modelLowpassFilterBank = createModel<LowpassFilterBank, LowpassFilterBankWidget>("LowpassFilterBank");
+Model* modelLowpassFilterBankExpander = createModel<LowpassFilterBankExpander, LowpassFilterBankExpanderWidget>("LowpassFilterBankExpander");
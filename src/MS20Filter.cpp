@@ -7,14 +7,27 @@
 #include <iomanip>
 
 #include "Agave.hpp"
-#include "dsp/MS20Filter.hpp"
+#include "dsp/FastMath.hpp"
+#include "dsp/MS20FilterSIMD.hpp"
+#include "dsp/Noise.hpp"
 #include "Components.hpp"
 
 namespace {
     constexpr float minCutoff = 50.0;
     constexpr float maxCutoff = 15.0e3;
+    const float log2CutoffRange = std::log2(maxCutoff / minCutoff);
+
+    // Voice sleep: a channel whose input and output stay below these levels for sleepTime,
+    // with resonance well under self-oscillation (which starts around 1.6), is put to sleep.
+    // The output threshold sits above the floor left by the bootstrap noise.
+    constexpr float sleepInputThreshold = 1.0e-3f;
+    constexpr float sleepOutputThreshold = 5.0e-2f;
+    constexpr float sleepResonance = 1.25f;
+    constexpr float sleepTime = 0.1f;
 }
 
+using simd::float_4;
+
 struct MS20VCF : Module {
     enum ParamIds {
         FREQ_PARAM,
@@ -35,14 +48,60 @@ struct MS20VCF : Module {
     enum LightIds {
         NUM_LIGHTS
     };
+    enum TanhQuality {
+        TANH_EXACT,
+        TANH_PADE,
+        TANH_POLYNOMIAL,
+        TANH_SPLINE,
+        NUM_TANH_QUALITIES
+    };
+    enum SolverMode {
+        SOLVER_NEWTON,
+        SOLVER_FIXED_NEWTON,
+        SOLVER_CHORD,
+        SOLVER_SEMI_IMPLICIT,
+        NUM_SOLVER_MODES
+    };
 
     float sampleRate = APP->engine->getSampleRate();
 
-    // Replace single filter with array of filters for polyphony
+    // Polyphony is processed four voices at a time
     static const int MAX_POLY = 16;
-    MS20Filter filters[MAX_POLY];
+    static const int NUM_GROUPS = MAX_POLY / 4;
+    MS20FilterSIMD filters[NUM_GROUPS];
     dsp::ClockDivider paramDivider;
 
+    // Accuracy of the tanh kernel used by the Newton solver (saved with the patch)
+    int tanhQuality = TANH_EXACT;
+
+    // Strategy for the implicit solve (saved with the patch)
+    int solverMode = SOLVER_NEWTON;
+
+    // Eco mode updates the filter coefficients every 16 samples instead of every sample
+    bool ecoMode = false;
+
+    // Bootstrap noise, one generator per group so sleeping groups don't shift the others.
+    // Deterministic mode uses a fixed seed, restarted on reset, for repeatable renders
+    Noise::XorshiftNoise noise[NUM_GROUPS];
+    bool deterministicNoise = false;
+    bool noiseSeededDeterministic = false;
+
+    // Voice sleep state per group: samples each lane has been quiet, lanes whose resonance
+    // allows sleeping (a mask), and whether the whole group is asleep
+    float_4 quietSamples[NUM_GROUPS] = {};
+    float_4 canSleep[NUM_GROUPS] = {};
+    bool asleep[NUM_GROUPS] = {};
+
+    // Set from the UI thread, handled at the start of the next process() call
+    bool statsResetRequested = false;
+
+    // Last values the coefficients were computed from
+    bool paramsDirty = true;
+    int lastChannels = 0;
+    float lastBaseFreq = 0.0f;
+    float lastCvAtt = 0.0f;
+    float lastResonance = 0.0f;
+
     MS20VCF() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
 
@@ -59,19 +118,33 @@ struct MS20VCF : Module {
         paramDivider.setDivision(16);
 
         // Initialize all filters with current sample rate
-        for (int i = 0; i < MAX_POLY; i++) {
-            filters[i].setSampleRate(APP->engine->getSampleRate());
+        for (int g = 0; g < NUM_GROUPS; g++) {
+            filters[g].setSampleRate(APP->engine->getSampleRate());
         }
+        seedNoise();
+    }
+
+    void seedNoise() {
+        uint32_t seed = deterministicNoise ? 0 : random::u32();
+        for (int g = 0; g < NUM_GROUPS; g++)
+            noise[g].seed(seed, g);
+        noiseSeededDeterministic = deterministicNoise;
     }
 
     void onSampleRateChange() override {
-        for (int i = 0; i < MAX_POLY; i++)
-            filters[i].setSampleRate(APP->engine->getSampleRate());
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setSampleRate(APP->engine->getSampleRate());
+        paramsDirty = true;
     }
 
     void onReset() override {
-        for (int i = 0; i < MAX_POLY; i++)
-            filters[i].reset();
+        for (int g = 0; g < NUM_GROUPS; g++) {
+            filters[g].reset();
+            quietSamples[g] = 0.0f;
+            asleep[g] = false;
+        }
+        seedNoise();
+        paramsDirty = true;
     }
 
     void process(const ProcessArgs& args) override {
@@ -81,45 +154,166 @@ struct MS20VCF : Module {
         // Set output channels to match input
         outputs[SIGNAL_OUTPUT].setChannels(channels);
 
-        if (paramDivider.process()) {
+        if (statsResetRequested) {
+            for (int g = 0; g < NUM_GROUPS; g++)
+                filters[g].stats = MS20FilterSIMD::NewtonStats();
+            statsResetRequested = false;
+        }
+
+        // The deterministic noise setting changed (from the menu or a loaded patch)
+        if (deterministicNoise != noiseSeededDeterministic)
+            seedNoise();
+
+        if (!ecoMode || paramDivider.process()) {
             float baseFreq = params[FREQ_PARAM].getValue();
             float cvAtt = params[CV_ATT_PARAM].getValue();
             float resonance = params[RES_PARAM].getValue();
 
-            // Process each channel
-            for (int c = 0; c < channels; c++) {
-                // Get CV for this channel (or use channel 0 if mono CV)
-                float freqCV = inputs[FREQ_CV_PARAM].getPolyVoltage(c);
-                float resCV = inputs[RES_CV_PARAM].getPolyVoltage(c);
+            // Skip the update entirely when the knobs haven't moved and no CV is patched
+            bool cvPatched = inputs[FREQ_CV_PARAM].isConnected() || inputs[RES_CV_PARAM].isConnected();
+            bool changed = paramsDirty || cvPatched || channels != lastChannels
+                || baseFreq != lastBaseFreq || cvAtt != lastCvAtt || resonance != lastResonance;
+
+            if (changed) {
+                // Process each group of four channels
+                for (int c = 0; c < channels; c += 4) {
+                    // Get CV for these channels (or use channel 0 if mono CV)
+                    float_4 freqCV = inputs[FREQ_CV_PARAM].getPolyVoltageSimd<float_4>(c);
+                    float_4 resCV = inputs[RES_CV_PARAM].getPolyVoltageSimd<float_4>(c);
 
-                // Calculate cutoff frequency
-                float cutoffCV = baseFreq + cvAtt * freqCV * 0.2f;
-                cutoffCV = clamp(cutoffCV, 0.0f, 1.0f);
-                float fc = minCutoff * powf(maxCutoff / minCutoff, cutoffCV);
+                    // Calculate cutoff frequency
+                    float_4 cutoffCV = baseFreq + cvAtt * freqCV * 0.2f;
+                    cutoffCV = simd::clamp(cutoffCV, 0.0f, 1.0f);
+                    float_4 fc = minCutoff * FastMath::exp2(log2CutoffRange * cutoffCV);
 
-                // Update filter parameters for this channel
-                filters[c].setParams(fc, resonance + resCV);
+                    // Update filter parameters for these channels
+                    filters[c / 4].setParams(fc, resonance + resCV);
+                    canSleep[c / 4] = (resonance + resCV) < sleepResonance;
+                }
+
+                paramsDirty = false;
+                lastChannels = channels;
+                lastBaseFreq = baseFreq;
+                lastCvAtt = cvAtt;
+                lastResonance = resonance;
             }
         }
 
-        // Process audio for each channel
-        for (int c = 0; c < channels; c++) {
-            // Get input for this channel
-            float input = inputs[SIGNAL_INPUT].getPolyVoltage(c);
-            input = clamp(input, -6.0f, 6.0f);
+        // Process audio, four channels at a time
+        for (int c = 0; c < channels; c += 4) {
+            // Get input for these channels
+            float_4 input = inputs[SIGNAL_INPUT].getPolyVoltageSimd<float_4>(c);
+            input = simd::clamp(input, -6.0f, 6.0f);
+
+            // Skip the group while all four voices are asleep. The output is already below
+            // the threshold when the group falls asleep, and it wakes from a zero state on the
+            // first loud input sample
+            int g = c / 4;
+            float_4 quiet = canSleep[g] & (simd::abs(input) < sleepInputThreshold)
+                & (simd::abs(5.0f * filters[g].getOutput()) < sleepOutputThreshold);
+            quietSamples[g] = simd::ifelse(quiet, quietSamples[g] + 1.0f, 0.0f);
+            if (simd::movemask(quietSamples[g] >= sleepTime * args.sampleRate) == 0xf) {
+                if (!asleep[g]) {
+                    filters[g].reset();
+                    asleep[g] = true;
+                }
+                outputs[SIGNAL_OUTPUT].setVoltageSimd(float_4(0.0f), c);
+                continue;
+            }
+            asleep[g] = false;
 
             // Add noise to bootstrap self-oscillation
-            input += 1.0e-2f * (2.0f * random::uniform() - 1.0f);
+            input += 1.0e-2f * noise[g].process();
 
             // Original MS20 used 4.0V pkk
             input *= 1.0f * 0.2f;
 
             // Process through filter
-            filters[c].process(input);
+            switch (tanhQuality) {
+                case TANH_PADE:
+                    processGroup<FastMath::TanhPade>(c / 4, input);
+                    break;
+                case TANH_POLYNOMIAL:
+                    processGroup<FastMath::TanhPolynomial>(c / 4, input);
+                    break;
+                case TANH_SPLINE:
+                    processGroup<FastMath::TanhSpline>(c / 4, input);
+                    break;
+                default:
+                    processGroup<FastMath::TanhExact>(c / 4, input);
+                    break;
+            }
+
+            // Set output for these channels
+            outputs[SIGNAL_OUTPUT].setVoltageSimd(5.0f * filters[c / 4].getOutput(), c);
+        }
+    }
+
+    template <typename Tanh>
+    void processGroup(int g, float_4 input) {
+        switch (solverMode) {
+            case SOLVER_FIXED_NEWTON:
+                filters[g].process<Tanh, MS20FilterSIMD::FixedNewtonSolver>(input);
+                break;
+            case SOLVER_CHORD:
+                filters[g].process<Tanh, MS20FilterSIMD::ChordSolver>(input);
+                break;
+            case SOLVER_SEMI_IMPLICIT:
+                filters[g].process<Tanh, MS20FilterSIMD::SemiImplicitSolver>(input);
+                break;
+            default:
+                filters[g].process<Tanh, MS20FilterSIMD::NewtonSolver>(input);
+                break;
+        }
+    }
+
+    // Newton solver statistics, summed over the channels in use
+    struct SolverSummary {
+        uint64_t histogram[MS20FilterSIMD::maxIterations + 1] = {};
+        uint64_t samples = 0;
+        uint64_t nonConverged = 0;
+        float largestFinalStep = 0.0f;
+    };
 
-            // Set output for this channel
-            outputs[SIGNAL_OUTPUT].setVoltage(5.0f * filters[c].getOutput(), c);
+    SolverSummary getSolverSummary() {
+        SolverSummary summary;
+        for (int c = 0; c < outputs[SIGNAL_OUTPUT].getChannels(); c++) {
+            MS20FilterSIMD::NewtonStats stats = filters[c / 4].stats;
+            for (int i = 0; i <= MS20FilterSIMD::maxIterations; i++) {
+                summary.histogram[i] += stats.histogram[c % 4][i];
+                summary.samples += stats.histogram[c % 4][i];
+            }
+            summary.nonConverged += stats.nonConverged[c % 4];
+            summary.largestFinalStep = std::max(summary.largestFinalStep, stats.largestFinalStep[c % 4]);
         }
+        return summary;
+    }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "tanhQuality", json_integer(tanhQuality));
+        json_object_set_new(rootJ, "solverMode", json_integer(solverMode));
+        json_object_set_new(rootJ, "ecoMode", json_boolean(ecoMode));
+        json_object_set_new(rootJ, "deterministicNoise", json_boolean(deterministicNoise));
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* tanhQualityJ = json_object_get(rootJ, "tanhQuality");
+        if (tanhQualityJ)
+            tanhQuality = clamp((int) json_integer_value(tanhQualityJ), 0, NUM_TANH_QUALITIES - 1);
+
+        json_t* solverModeJ = json_object_get(rootJ, "solverMode");
+        if (solverModeJ)
+            solverMode = clamp((int) json_integer_value(solverModeJ), 0, NUM_SOLVER_MODES - 1);
+
+        json_t* ecoModeJ = json_object_get(rootJ, "ecoMode");
+        if (ecoModeJ)
+            ecoMode = json_boolean_value(ecoModeJ);
+
+        json_t* deterministicNoiseJ = json_object_get(rootJ, "deterministicNoise");
+        if (deterministicNoiseJ)
+            deterministicNoise = json_boolean_value(deterministicNoiseJ);
     }
 };
 
@@ -147,6 +341,51 @@ struct MS20VCFWidget : ModuleWidget {
         // AUDIO OUTPUT
         addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 105.0)), module, MS20VCF::SIGNAL_OUTPUT));
     }
+
+    void appendContextMenu(Menu* menu) override {
+        MS20VCF* module = dynamic_cast<MS20VCF*>(this->module);
+        if (!module)
+            return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createIndexPtrSubmenuItem("Nonlinearity quality", {
+            "Exact",
+            "Pade (err 1e-4)",
+            "Polynomial (err 5e-3)",
+            "Spline table (err 3e-6)"
+        }, &module->tanhQuality));
+        menu->addChild(createIndexPtrSubmenuItem("Solver", {
+            "Newton (reference)",
+            "Fixed 2-step Newton",
+            "Chord (reused Jacobian)",
+            "Semi-implicit (1 step)"
+        }, &module->solverMode));
+        menu->addChild(createBoolPtrMenuItem("Eco mode", "CV every 16 samples", &module->ecoMode));
+        menu->addChild(createBoolPtrMenuItem("Deterministic noise", "", &module->deterministicNoise));
+
+        menu->addChild(createSubmenuItem("Solver statistics", "", [=](Menu* menu) {
+            MS20VCF::SolverSummary summary = module->getSolverSummary();
+            if (summary.samples == 0) {
+                menu->addChild(createMenuLabel("No samples processed"));
+                return;
+            }
+
+            double meanIterations = 0.0;
+            for (int i = 1; i <= MS20FilterSIMD::maxIterations; i++)
+                meanIterations += i * (double) summary.histogram[i] / summary.samples;
+
+            menu->addChild(createMenuLabel(string::f("Mean iterations: %.2f", meanIterations)));
+            for (int i = 1; i <= MS20FilterSIMD::maxIterations; i++) {
+                if (summary.histogram[i] > 0)
+                    menu->addChild(createMenuLabel(string::f("%d iterations: %.1f%%", i, 100.0 * summary.histogram[i] / summary.samples)));
+            }
+            menu->addChild(createMenuLabel(string::f("Not converged: %.3f%%", 100.0 * summary.nonConverged / summary.samples)));
+            menu->addChild(createMenuLabel(string::f("Largest final step: %.2g", summary.largestFinalStep)));
+            menu->addChild(createMenuItem("Reset statistics", "", [=]() {
+                module->statsResetRequested = true;
+            }));
+        }));
+    }
 };
 
 Model* modelMS20VCF = createModel<MS20VCF, MS20VCFWidget>("MS20VCF");
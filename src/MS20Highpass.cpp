@@ -0,0 +1,204 @@
+//
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+//
+#include "Agave.hpp"
+#include "dsp/FastMath.hpp"
+#include "dsp/MS20HighpassSIMD.hpp"
+#include "dsp/Noise.hpp"
+#include "Components.hpp"
+
+namespace {
+    constexpr float minCutoff = 50.0;
+    constexpr float maxCutoff = 15.0e3;
+    const float log2CutoffRange = std::log2(maxCutoff / minCutoff);
+}
+
+using simd::float_4;
+
+struct MS20HPF : Module {
+    enum ParamIds {
+        FREQ_PARAM,
+        CV_ATT_PARAM,
+        RES_PARAM,
+        NUM_PARAMS
+    };
+    enum InputIds {
+        SIGNAL_INPUT,
+        FREQ_CV_PARAM,
+        RES_CV_PARAM,
+        NUM_INPUTS
+    };
+    enum OutputIds {
+        SIGNAL_OUTPUT,
+        NUM_OUTPUTS
+    };
+    enum LightIds {
+        NUM_LIGHTS
+    };
+    enum TanhQuality {
+        TANH_EXACT,
+        TANH_PADE,
+        TANH_POLYNOMIAL,
+        TANH_SPLINE,
+        NUM_TANH_QUALITIES
+    };
+
+    // Polyphony is processed four voices at a time
+    static const int MAX_POLY = 16;
+    static const int NUM_GROUPS = MAX_POLY / 4;
+    MS20HighpassSIMD filters[NUM_GROUPS];
+
+    // Accuracy of the tanh kernel used by the Newton solver (saved with the patch)
+    int tanhQuality = TANH_EXACT;
+
+    // Bootstrap noise, one generator per group (see MS20VCF)
+    Noise::XorshiftNoise noise[NUM_GROUPS];
+    bool deterministicNoise = false;
+    bool noiseSeededDeterministic = false;
+
+    MS20HPF() {
+        config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
+
+        configInput(SIGNAL_INPUT, "Signal");
+        configInput(FREQ_CV_PARAM, "Frequency CV");
+        configInput(RES_CV_PARAM, "Resonance CV");
+        configOutput(SIGNAL_OUTPUT, "Signal");
+        configBypass(SIGNAL_INPUT, SIGNAL_OUTPUT);
+
+        configParam(FREQ_PARAM, 0.f, 1.f, 0.5f, "Frequency", " Hz", maxCutoff / minCutoff, minCutoff);
+        configParam(CV_ATT_PARAM, -1.0f, 1.0f, 0.0f, "CV Attenuverter");
+        configParam(RES_PARAM, 0.f, 2.f, 0.0f, "Resonance");
+
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setSampleRate(APP->engine->getSampleRate());
+        seedNoise();
+    }
+
+    void seedNoise() {
+        uint32_t seed = deterministicNoise ? 0 : random::u32();
+        for (int g = 0; g < NUM_GROUPS; g++)
+            noise[g].seed(seed, g);
+        noiseSeededDeterministic = deterministicNoise;
+    }
+
+    void onSampleRateChange() override {
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].setSampleRate(APP->engine->getSampleRate());
+    }
+
+    void onReset() override {
+        for (int g = 0; g < NUM_GROUPS; g++)
+            filters[g].reset();
+        seedNoise();
+    }
+
+    void process(const ProcessArgs& args) override {
+        int channels = std::max({inputs[SIGNAL_INPUT].getChannels(), inputs[FREQ_CV_PARAM].getChannels(), inputs[RES_CV_PARAM].getChannels()});
+        outputs[SIGNAL_OUTPUT].setChannels(channels);
+
+        if (deterministicNoise != noiseSeededDeterministic)
+            seedNoise();
+
+        float baseFreq = params[FREQ_PARAM].getValue();
+        float cvAtt = params[CV_ATT_PARAM].getValue();
+        float resonance = params[RES_PARAM].getValue();
+
+        for (int c = 0; c < channels; c += 4) {
+            int g = c / 4;
+
+            // Cutoff and resonance for these channels (mono CV applies to all of them)
+            float_4 freqCV = inputs[FREQ_CV_PARAM].getPolyVoltageSimd<float_4>(c);
+            float_4 resCV = inputs[RES_CV_PARAM].getPolyVoltageSimd<float_4>(c);
+            float_4 cutoffCV = simd::clamp(baseFreq + cvAtt * freqCV * 0.2f, 0.0f, 1.0f);
+            float_4 fc = minCutoff * FastMath::exp2(log2CutoffRange * cutoffCV);
+            filters[g].setParams(fc, resonance + resCV);
+
+            float_4 input = inputs[SIGNAL_INPUT].getPolyVoltageSimd<float_4>(c);
+            input = simd::clamp(input, -6.0f, 6.0f);
+
+            // Add noise to bootstrap self-oscillation
+            input += 1.0e-2f * noise[g].process();
+
+            // Original MS20 used 4.0V pkk
+            input *= 0.2f;
+
+            switch (tanhQuality) {
+                case TANH_PADE:
+                    filters[g].process<FastMath::TanhPade>(input);
+                    break;
+                case TANH_POLYNOMIAL:
+                    filters[g].process<FastMath::TanhPolynomial>(input);
+                    break;
+                case TANH_SPLINE:
+                    filters[g].process<FastMath::TanhSpline>(input);
+                    break;
+                default:
+                    filters[g].process<FastMath::TanhExact>(input);
+                    break;
+            }
+
+            outputs[SIGNAL_OUTPUT].setVoltageSimd(5.0f * filters[g].getOutput(), c);
+        }
+    }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "tanhQuality", json_integer(tanhQuality));
+        json_object_set_new(rootJ, "deterministicNoise", json_boolean(deterministicNoise));
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* tanhQualityJ = json_object_get(rootJ, "tanhQuality");
+        if (tanhQualityJ)
+            tanhQuality = clamp((int) json_integer_value(tanhQualityJ), 0, NUM_TANH_QUALITIES - 1);
+
+        json_t* deterministicNoiseJ = json_object_get(rootJ, "deterministicNoise");
+        if (deterministicNoiseJ)
+            deterministicNoise = json_boolean_value(deterministicNoiseJ);
+    }
+};
+
+namespace Comps = AgaveComponents;
+
+struct MS20HPFWidget : ModuleWidget {
+    MS20HPFWidget(MS20HPF* module) {
+        setModule(module);
+        setPanel(createPanel(asset::plugin(pluginInstance, "res/MS20HPF.svg")));
+
+        Comps::createScrews<Comps::ScrewMetal>(*this);
+
+        // AUDIO INPUT
+        addInput(createInputCentered<Comps::InputPort>(mm2px(Vec(10.16, 21.25)), module, MS20HPF::SIGNAL_INPUT));
+
+        // FREQUENCY PARAM
+        addParam(createParamCentered<Comps::Knob>(mm2px(Vec(8.82, 37.5)), module, MS20HPF::FREQ_PARAM));
+        addParam(createParamCentered<Comps::SmallKnob>(mm2px(Vec(10.16, 55.0)), module, MS20HPF::CV_ATT_PARAM));
+        addInput(createInputCentered<Comps::InputPort>(mm2px(Vec(10.16, 63.0)), module, MS20HPF::FREQ_CV_PARAM));
+
+        // Resonance PARAM
+        addParam(createParamCentered<Comps::Knob>(mm2px(Vec(8.82, 80.0)), module, MS20HPF::RES_PARAM));
+        addInput(createInputCentered<Comps::InputPort>(mm2px(Vec(10.16, 93.0)), module, MS20HPF::RES_CV_PARAM));
+
+        // AUDIO OUTPUT
+        addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 105.0)), module, MS20HPF::SIGNAL_OUTPUT));
+    }
+
+    void appendContextMenu(Menu* menu) override {
+        MS20HPF* module = dynamic_cast<MS20HPF*>(this->module);
+        if (!module)
+            return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createIndexPtrSubmenuItem("Nonlinearity quality", {
+            "Exact",
+            "Pade (err 1e-4)",
+            "Polynomial (err 5e-3)",
+            "Spline table (err 3e-6)"
+        }, &module->tanhQuality));
+        menu->addChild(createBoolPtrMenuItem("Deterministic noise", "", &module->deterministicNoise));
+    }
+};
+
+Model* modelMS20HPF = createModel<MS20HPF, MS20HPFWidget>("MS20HPF");
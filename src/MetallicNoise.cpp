@@ -1,6 +1,6 @@
 // THIS MODULE GENERATES "METALLIC NOISE" SIMILAR TO THAT USED IN THE 
 // ROLAND TR-808 AND TR-606 RHYTHM COMPOSERS TO CREATE THE CYMBAL AND 
-// HI-HAT VOICES. 
+// HI-HAT VOICES. EACH OUTPUT CAN ALSO CARRY DIGITAL (LFSR) NOISE.
 // 
 // RECOMMENDED USE: METALLIC_NOISE -> HPF -> VCA WITH SNAPPY ENVELOPES
 // 
@@ -11,15 +11,33 @@
 // ADAPTED FOR VCV RACK JANUARY 2018
 // 
 // TODO: 
-//      ADD MORE NOISE SOURCES: DIGITAL NOISE, DR-110 & KR-55 NOISES
+//      ADD MORE NOISE SOURCES: DR-110 & KR-55 NOISES
 
 #include "Agave.hpp"
 #include <iostream>
 #include <array>
 
-#include "dsp/DPWOsc.hpp"
+using simd::float_4;
+
+#include "dsp/DPWOscSIMD.hpp"
+#include "dsp/LFSRNoise.hpp"
 #include "Components.hpp"
 
+namespace {
+    // Gated mode: how long a voice sounds after a trigger
+    constexpr int numHoldTimes = 6;
+    constexpr float holdTimes[numHoldTimes] = {0.05f, 0.1f, 0.2f, 0.5f, 1.0f, 2.0f};
+    constexpr int defaultHoldTime = 2;
+
+    // The decay envelope is down 60 dB when the hold time runs out
+    constexpr float decayFloor = 1.0e-3f;
+
+    // Digital noise swings between -digitalLevel and digitalLevel before the output gain,
+    // the RMS level of six summed squares (sqrt(6)), so all sources are about as loud
+    constexpr float digitalLevel = 2.449f;
+    constexpr uint32_t digitalSeed = 0x1a3c96e1u; // Any nonzero 31-bit value
+}
+
 struct MetallicNoise : Module {
     enum ParamIds {
         NUM_PARAMS
@@ -36,18 +54,71 @@ struct MetallicNoise : Module {
     enum LightIds {
         NUM_LIGHTS
     };
+    enum Source {
+        SOURCE_808,
+        SOURCE_606,
+        SOURCE_DIGITAL,
+        NUM_SOURCES
+    };
+    enum TriggerMode {
+        TRIGGER_FREE_RUNNING,
+        TRIGGER_GATED,
+        NUM_TRIGGER_MODES
+    };
 
     static const int MAX_POLY = 16;
+    static const int NUM_GROUPS = MAX_POLY / 4;
     float sampleRate = APP->engine->getSampleRate();
 
-    // Declare 2 arrays of oscillators for each polyphonic channel
-    std::array<DPWSquare, 6> squareWaves808[MAX_POLY];
-    std::array<DPWSquare, 6> squareWaves606[MAX_POLY];
+    // All 12 oscillators of each polyphonic channel in one bank: the 808 set in lanes 0-5
+    // and the 606 set in lanes 6-11 of the bank's three vectors. They are only run while an
+    // output carries one of them
+    DPWSquareBankSIMD<12> oscillators[MAX_POLY];
 
     // Define fundamental frequencies
     std::array<float, 6> oscFrequencies808 = {{205.3f, 369.4f, 304.4f, 522.3f, 800.0f, 540.4f}};
     std::array<float, 6> oscFrequencies606 = {{244.4f, 304.6f, 364.5f, 412.1f, 432.4f, 604.1f}};
 
+    // 1-bit digital noise, one LFSR lane per channel
+    LFSRNoiseBank digitalNoise;
+    uint32_t digitalBits = 0;
+
+    // Source of each output (saved with the patch), read once per sample
+    int sources[NUM_OUTPUTS] = {SOURCE_808, SOURCE_606};
+    int activeSources[NUM_OUTPUTS] = {SOURCE_808, SOURCE_606};
+    bool oscillatorsInUse = true;
+
+    // Voices whose oscillators and digital noise lane are in the same state as voice 0's.
+    // There is no per-voice parameter, so these are computed once (as voice 0) and the output
+    // is broadcast; their own oscillators are left untouched. A voice that stops while voice 0
+    // keeps running diverges: it takes a copy of voice 0's state and is run on its own from
+    // then on
+    std::array<bool, MAX_POLY> synced;
+    int previousChannels = 0;
+
+    // What TRIG does (saved with the patch). Free running ignores its voltage and only takes
+    // the channel count from it; gated restarts a voice on each rising edge and lets it sound
+    // for the hold time, after which it is idle (silent, and its oscillators aren't run). A
+    // mode change is applied at the start of the next process() call, which restarts all voices
+    int triggerMode = TRIGGER_FREE_RUNNING;
+    int activeTriggerMode = TRIGGER_FREE_RUNNING;
+    int holdTime = defaultHoldTime;
+    bool decayEnvelope = true;
+
+    // Start the oscillators at fixed, spread-out phases on a trigger instead of all at 0.
+    // The same phases every time, so voices triggered together stay identical
+    bool phaseSpread = false;
+    bool activePhaseSpread = false;
+
+    // Gated mode state of each voice, part of what a synced voice shares with voice 0
+    struct Gate {
+        int remaining = 0; // Samples left before going idle
+        float envelope = 0.0f;
+        float decay = 1.0f; // Per-sample envelope factor
+    };
+    std::array<Gate, MAX_POLY> gates;
+    dsp::TSchmittTrigger<float_4> triggers[NUM_GROUPS];
+
     MetallicNoise() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
 
@@ -56,12 +127,108 @@ struct MetallicNoise : Module {
         configOutput(NOISE_606_OUTPUT, "606");
 
         // Initialize all oscillators for all channels
+        std::array<float, 12> frequencies;
+        std::copy(oscFrequencies808.begin(), oscFrequencies808.end(), frequencies.begin());
+        std::copy(oscFrequencies606.begin(), oscFrequencies606.end(), frequencies.begin() + 6);
+        for (int c = 0; c < MAX_POLY; c++)
+            oscillators[c].setFrequencies(frequencies.data(), sampleRate);
+        digitalNoise.seed(0xffffffffu, digitalSeed);
+        synced.fill(true);
+    }
+
+    // Also names the output after its source
+    void setSource(int output, int source) {
+        static const char* names[NUM_SOURCES] = {"808", "606", "Digital noise"};
+        sources[output] = source;
+        outputInfos[output]->name = names[source];
+    }
+
+    // Voice c leaves voice 0's state, keeping a copy of it
+    void diverge(int c) {
+        oscillators[c] = oscillators[0];
+        digitalNoise.copyLane(0, c);
+        gates[c] = gates[0];
+        synced[c] = false;
+    }
+
+    void restartVoices() {
+        for (int c = 0; c < MAX_POLY; c++) {
+            oscillators[c].reset();
+            gates[c] = Gate();
+        }
+        digitalNoise.seed(0xffffffffu, digitalSeed);
+        synced.fill(true);
+        previousChannels = 0;
+    }
+
+    void setPhaseSpread(bool spread) {
+        // Golden ratio steps, the most even spread for any number of oscillators
+        std::array<float, 12> phases;
+        for (int i = 0; i < 12; i++)
+            phases[i] = spread ? std::fmod(0.618034f * i, 1.0f) : 0.0f;
+        for (int c = 0; c < MAX_POLY; c++)
+            oscillators[c].setStartPhases(phases.data());
+    }
+
+    void startVoice(int c) {
+        const int holdSamples = std::max(1, (int) (holdTimes[holdTime] * sampleRate));
+        oscillators[c].reset();
+        digitalNoise.seed(1u << c, digitalSeed);
+        gates[c].remaining = holdSamples;
+        gates[c].envelope = 1.0f;
+        gates[c].decay = std::pow(decayFloor, 1.0f / holdSamples);
+    }
+
+    // Takes one bit per channel. Voices triggered together with voice 0 restart in the same
+    // state as it, so they are synced again; a synced voice triggered without voice 0 (or
+    // left behind when voice 0 is triggered) diverges before voice 0 restarts
+    void startVoices(int triggered) {
+        const bool first = triggered & 1;
+        for (int c = 1; c < MAX_POLY; c++) {
+            const bool t = (triggered >> c) & 1;
+            if (synced[c] && t != first)
+                diverge(c);
+            else if (!synced[c] && t && first)
+                synced[c] = true;
+        }
         for (int c = 0; c < MAX_POLY; c++) {
-            for (auto &squareWave : squareWaves808[c])
-                squareWave.setSampleRate(sampleRate);
-            for (auto &squareWave : squareWaves606[c])
-                squareWave.setSampleRate(sampleRate);
+            if (((triggered >> c) & 1) && (c == 0 || !synced[c]))
+                startVoice(c);
+        }
+    }
+
+    void processVoice(int c) {
+        float gain = 5.0f * 0.1666f;
+        if (activeTriggerMode == TRIGGER_GATED) {
+            Gate& gate = gates[c];
+            if (gate.remaining == 0) {
+                outputs[NOISE_808_OUTPUT].setVoltage(0.0f, c);
+                outputs[NOISE_606_OUTPUT].setVoltage(0.0f, c);
+                return;
+            }
+            gate.remaining--;
+            if (decayEnvelope)
+                gain *= gate.envelope;
+            gate.envelope *= gate.decay;
+        }
+
+        float level[NUM_SOURCES] = {};
+        if (oscillatorsInUse) {
+            oscillators[c].process();
+            float_4 v0 = oscillators[c].getSquareWaveforms(0);
+            float_4 v1 = oscillators[c].getSquareWaveforms(1);
+            float_4 v2 = oscillators[c].getSquareWaveforms(2);
+
+            // 808 Noise
+            level[SOURCE_808] = v0[0] + v0[1] + v0[2] + v0[3] + v1[0] + v1[1];
+
+            // 606 Noise
+            level[SOURCE_606] = v1[2] + v1[3] + v2[0] + v2[1] + v2[2] + v2[3];
         }
+        level[SOURCE_DIGITAL] = ((digitalBits >> c) & 1) ? digitalLevel : -digitalLevel;
+
+        for (int o = 0; o < NUM_OUTPUTS; o++)
+            outputs[o].setVoltage(gain * level[activeSources[o]], c);
     }
 
     void process(const ProcessArgs& args) override {
@@ -72,32 +239,112 @@ struct MetallicNoise : Module {
         outputs[NOISE_808_OUTPUT].setChannels(channels);
         outputs[NOISE_606_OUTPUT].setChannels(channels);
 
-        // Process each channel
-        for (int c = 0; c < channels; c++) {
-            // 808 Noise
-            float output808 = 0.0f;
-            for (int i = 0; i < 6; i++) {
-                squareWaves808[c][i].generateSamples(oscFrequencies808[i]);
-                output808 += squareWaves808[c][i].getSquareWaveform();
+        if (triggerMode != activeTriggerMode) {
+            restartVoices();
+            activeTriggerMode = triggerMode;
+        }
+
+        if (phaseSpread != activePhaseSpread) {
+            setPhaseSpread(phaseSpread);
+            activePhaseSpread = phaseSpread;
+            // Free-running voices never restart on their own, so restart them now to hear it
+            if (activeTriggerMode == TRIGGER_FREE_RUNNING)
+                restartVoices();
+        }
+
+        if (channels == 0)
+            return;
+
+        bool digitalInUse = false;
+        oscillatorsInUse = false;
+        for (int o = 0; o < NUM_OUTPUTS; o++) {
+            activeSources[o] = sources[o];
+            if (activeSources[o] == SOURCE_DIGITAL)
+                digitalInUse = true;
+            else
+                oscillatorsInUse = true;
+        }
+
+        // Synced voices past the channel count stop here, while voice 0 runs on
+        if (channels != previousChannels) {
+            for (int c = channels; c < MAX_POLY; c++) {
+                if (synced[c])
+                    diverge(c);
             }
-            outputs[NOISE_808_OUTPUT].setVoltage(5.0f * 0.1666f * output808, c);
+            previousChannels = channels;
+        }
 
-            // 606 Noise
-            float output606 = 0.0f;
-            for (int i = 0; i < 6; i++) {
-                squareWaves606[c][i].generateSamples(oscFrequencies606[i]);
-                output606 += squareWaves606[c][i].getSquareWaveform();
+        if (activeTriggerMode == TRIGGER_GATED) {
+            int triggered = 0;
+            for (int c = 0; c < channels; c += 4) {
+                float_4 edges = triggers[c / 4].process(inputs[TRIG_INPUT].getVoltageSimd<float_4>(c));
+                triggered |= simd::movemask(edges) << c;
+            }
+            // Lanes past the channel count read stale voltages
+            triggered &= (1 << channels) - 1;
+            if (triggered)
+                startVoices(triggered);
+        }
+
+        // All channels' noise bits in one step
+        if (digitalInUse)
+            digitalBits = digitalNoise.process();
+
+        // Voice 0 is computed for all synced voices, the others one by one
+        processVoice(0);
+        float voice808 = outputs[NOISE_808_OUTPUT].getVoltage(0);
+        float voice606 = outputs[NOISE_606_OUTPUT].getVoltage(0);
+        for (int c = 1; c < channels; c++) {
+            if (synced[c]) {
+                outputs[NOISE_808_OUTPUT].setVoltage(voice808, c);
+                outputs[NOISE_606_OUTPUT].setVoltage(voice606, c);
+            }
+            else {
+                processVoice(c);
             }
-            outputs[NOISE_606_OUTPUT].setVoltage(5.0f * 0.1666f * output606, c);
         }
     }
 
     void onSampleRateChange() override {
-        for (int c = 0; c < MAX_POLY; c++) {
-            for (auto &squareWave : squareWaves808[c])
-                squareWave.setSampleRate(APP->engine->getSampleRate());
-            for (auto &squareWave : squareWaves606[c])
-                squareWave.setSampleRate(APP->engine->getSampleRate());
+        sampleRate = APP->engine->getSampleRate();
+        for (int c = 0; c < MAX_POLY; c++)
+            oscillators[c].setSampleRate(sampleRate);
+    }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "triggerMode", json_integer(triggerMode));
+        json_object_set_new(rootJ, "holdTime", json_integer(holdTime));
+        json_object_set_new(rootJ, "decayEnvelope", json_boolean(decayEnvelope));
+        json_object_set_new(rootJ, "phaseSpread", json_boolean(phaseSpread));
+        json_t* sourcesJ = json_array();
+        for (int o = 0; o < NUM_OUTPUTS; o++)
+            json_array_append_new(sourcesJ, json_integer(sources[o]));
+        json_object_set_new(rootJ, "sources", sourcesJ);
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* triggerModeJ = json_object_get(rootJ, "triggerMode");
+        if (triggerModeJ)
+            triggerMode = clamp((int) json_integer_value(triggerModeJ), 0, NUM_TRIGGER_MODES - 1);
+
+        json_t* holdTimeJ = json_object_get(rootJ, "holdTime");
+        if (holdTimeJ)
+            holdTime = clamp((int) json_integer_value(holdTimeJ), 0, numHoldTimes - 1);
+
+        json_t* decayEnvelopeJ = json_object_get(rootJ, "decayEnvelope");
+        if (decayEnvelopeJ)
+            decayEnvelope = json_boolean_value(decayEnvelopeJ);
+
+        json_t* phaseSpreadJ = json_object_get(rootJ, "phaseSpread");
+        if (phaseSpreadJ)
+            phaseSpread = json_boolean_value(phaseSpreadJ);
+
+        json_t* sourcesJ = json_object_get(rootJ, "sources");
+        if (sourcesJ) {
+            for (int o = 0; o < NUM_OUTPUTS && o < (int) json_array_size(sourcesJ); o++)
+                setSource(o, clamp((int) json_integer_value(json_array_get(sourcesJ, o)), 0, NUM_SOURCES - 1));
         }
     }
 };
@@ -114,10 +361,38 @@ struct MetallicNoiseWidget : ModuleWidget {
         // TRIGGER INPUT
         addInput(createInputCentered<Comps::InputPort>(mm2px(Vec(10.16, 21.25)), module, MetallicNoise::TRIG_INPUT));
 
-        // NOISE OUTPUTS
+        // NOISE OUTPUTS, NAMED AFTER THEIR DEFAULT SOURCES
         addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 40.0)), module, MetallicNoise::NOISE_606_OUTPUT));
         addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 80.0)), module, MetallicNoise::NOISE_808_OUTPUT));
     }
+
+    void appendContextMenu(Menu* menu) override {
+        MetallicNoise* module = dynamic_cast<MetallicNoise*>(this->module);
+        if (!module)
+            return;
+
+        const std::vector<std::string> sourceLabels = {
+            "TR-808", "TR-606", "Digital (LFSR)"
+        };
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createIndexSubmenuItem("Top output", sourceLabels,
+            [=]() { return module->sources[MetallicNoise::NOISE_606_OUTPUT]; },
+            [=](int index) { module->setSource(MetallicNoise::NOISE_606_OUTPUT, index); }
+        ));
+        menu->addChild(createIndexSubmenuItem("Bottom output", sourceLabels,
+            [=]() { return module->sources[MetallicNoise::NOISE_808_OUTPUT]; },
+            [=](int index) { module->setSource(MetallicNoise::NOISE_808_OUTPUT, index); }
+        ));
+        menu->addChild(createIndexPtrSubmenuItem("Trigger", {
+            "Channel count only (original)",
+            "Starts the voice"
+        }, &module->triggerMode));
+        menu->addChild(createIndexPtrSubmenuItem("Hold time", {
+            "50 ms", "100 ms", "200 ms", "500 ms", "1 s", "2 s"
+        }, &module->holdTime));
+        menu->addChild(createBoolPtrMenuItem("Decay envelope", "", &module->decayEnvelope));
+        menu->addChild(createBoolPtrMenuItem("Phase spread", "", &module->phaseSpread));
+    }
 };
 
 Model* modelMetallicNoise = createModel<MetallicNoise, MetallicNoiseWidget>("MetallicNoise");
@@ -1,4 +1,5 @@
-// THIS MODULE IMPLEMENTS A FOUR-STAGE WAVEFOLDER. THE FOLDING
+// THIS MODULE IMPLEMENTS A MULTI-STAGE WAVEFOLDER (FOUR STAGES BY
+// DEFAULT, ONE TO EIGHT FROM THE CONTEXT MENU). THE FOLDING
 // FUNCTION USED IS VERY SHARP, SIMILAR TO THAT OF THE BUCHLA 
 // 259 TIMBRE SECTION. 
 // 
@@ -14,8 +15,30 @@
 #include <array>
 
 #include "Components.hpp"
-#include "dsp/Filters.hpp"
-#include "dsp/Waveshaping.hpp"
+#include "dsp/FiltersSIMD.hpp"
+#include "dsp/RingBuffer.hpp"
+#include "dsp/WaveshapingSIMD.hpp"
+
+using simd::float_4;
+
+namespace {
+    // Knobs are read every controlDivision samples and slewed towards the new values with a
+    // one-pole lowpass of time constant smoothingTime, which keeps knob moves zipper-free
+    constexpr int controlDivision = 32;
+    constexpr float smoothingTime = 5.0e-3f;
+
+    // Selectable depth of the fold cascade
+    constexpr int maxStages = 8;
+    constexpr int defaultStages = 4;
+
+    // A group whose fold input peaks below linearThreshold for a whole control block skips
+    // the antialiased fold until the input reaches 1 (where folding starts)
+    constexpr float linearThreshold = 0.95f;
+
+    // Telemetry frames queued for the transfer curve display (one per control block, so
+    // about 0.2 s of history at 44.1 kHz before frames are dropped)
+    constexpr int telemetrySize = 256;
+}
 
 struct SharpWavefolder : Module {
     enum ParamIds {
@@ -38,16 +61,70 @@ struct SharpWavefolder : Module {
     enum LightIds {
         NUM_LIGHTS
     };
+    enum Antialiasing {
+        AA_NAIVE,
+        AA_ADAA1,
+        AA_ADAA2,
+        AA_ADAA2_OVERSAMPLED,
+        NUM_ANTIALIASING
+    };
+    enum Saturator {
+        SATURATOR_HARD,
+        SATURATOR_SOFT,
+        NUM_SATURATORS
+    };
 
+    // Polyphony is processed four voices at a time
     static const int MAX_POLY = 16;
+    static const int NUM_GROUPS = MAX_POLY / 4;
     float sampleRate = APP->engine->getSampleRate();
 
-    // Array of folders for each polyphonic channel
-    std::array<Wavefolder, 4> folder[MAX_POLY];
-    HardClipper clipper[MAX_POLY];
+    // Fold cascade for each group of four channels, with room for the deepest setting
+    FoldCascadeSIMD<maxStages> folder[NUM_GROUPS];
+    HardClipperSIMD clipper[NUM_GROUPS];
+    SoftClipperSIMD softClipper[NUM_GROUPS];
+
+    // Output saturator (saved with the patch), applied like the antialiasing setting
+    int saturator = SATURATOR_HARD;
+    int activeSaturator = SATURATOR_HARD;
+
+    // Antialiasing of the fold cascade (saved with the patch). A change is applied at the
+    // start of the next process() call, which clears the cascade and resampler state
+    int antialiasing = AA_ADAA2;
+    int activeAntialiasing = AA_ADAA2;
+
+    // Number of fold stages (saved with the patch), applied like the antialiasing setting
+    int stages = defaultStages;
+    int activeStages = defaultStages;
+    UpsamplerSIMD upsampler[NUM_GROUPS];
+    DecimatorSIMD decimator[NUM_GROUPS];
+
+    // Linear-region fast path, per group (see FoldCascadeSIMD::processLinear)
+    bool linearPath[NUM_GROUPS] = {};
+    float_4 blockPeak[NUM_GROUPS] = {};
+    bool endOfBlock = false;
 
     static constexpr float dcFreq = 10.0f;
-    DCBlocker dcBlocker[MAX_POLY];
+    DCBlockerSIMD dcBlocker[NUM_GROUPS];
+
+    // Channel 0 snapshot, taken once per control block for the transfer curve display. The
+    // output is taken before the DC blocker, so it lies on the static curve (up to the
+    // group delay of the cascade)
+    struct Telemetry {
+        float input;
+        float output;
+        float foldLevel;
+        float symmLevel;
+    };
+    SPSCRingBuffer<Telemetry, telemetrySize> telemetry;
+
+    // Control-rate knob snapshot and its smoothed value, one param per lane
+    // (NUM_PARAMS is 4, so all knobs slew in a single float_4 operation)
+    dsp::ClockDivider controlDivider;
+    float_4 knobTarget = 0.0f;
+    float_4 knob = 0.0f;
+    float smoothingCoeff = 1.0f;
+    bool snapKnobs = true;
 
     SharpWavefolder() {
         config(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS);
@@ -64,8 +141,19 @@ struct SharpWavefolder : Module {
         configParam(SYMM_ATT_PARAM, -1.0f, 1.0f, 0.0f, "Symmetry CV attenuverter", "%", 0, 100);
 
         // Initialize all filters
-        for (int c = 0; c < MAX_POLY; c++)
-            dcBlocker[c].setSampleRate(sampleRate);
+        for (int g = 0; g < NUM_GROUPS; g++)
+            dcBlocker[g].setSampleRate(sampleRate);
+
+        controlDivider.setDivision(controlDivision);
+        setSmoothing();
+    }
+
+    void setSmoothing() {
+        smoothingCoeff = 1.0f - std::exp(-1.0f / (smoothingTime * sampleRate));
+    }
+
+    void onReset() override {
+        snapKnobs = true;
     }
 
     void process(const ProcessArgs& args) override {
@@ -77,48 +165,242 @@ struct SharpWavefolder : Module {
         // Set output channels
         outputs[FOLDED_OUTPUT].setChannels(channels);
 
-        for (int c = 0; c < channels; c++) {
+        // Snapshot the knobs at control rate. The first snapshot after construction, patch
+        // load or reset is taken as is, so the module doesn't sweep from the default values
+        endOfBlock = controlDivider.process();
+        if (endOfBlock || snapKnobs) {
+            for (int i = 0; i < NUM_PARAMS; i++)
+                knobTarget[i] = params[i].getValue();
+            if (snapKnobs) {
+                knob = knobTarget;
+                snapKnobs = false;
+            }
+        }
+        knob += smoothingCoeff * (knobTarget - knob);
+
+        // Mono or unpatched CV is the same for every channel, so the levels are computed
+        // once here and broadcast; only polyphonic CV is read per group
+        bool foldPoly = inputs[FOLD_CV_INPUT].getChannels() > 1;
+        bool symmPoly = inputs[SYMM_CV_INPUT].getChannels() > 1;
+        float_4 foldLevel = 0.0f, symmLevel = 0.0f;
+        if (!foldPoly)
+            foldLevel = clamp(knob[FOLDS_PARAM] + knob[FOLD_ATT_PARAM] * std::abs(inputs[FOLD_CV_INPUT].getVoltage()), -10.0f, 10.0f);
+        if (!symmPoly)
+            symmLevel = clamp(knob[SYMM_PARAM] + 0.5f * knob[SYMM_ATT_PARAM] * inputs[SYMM_CV_INPUT].getVoltage(), -5.0f, 5.0f);
+
+        if (antialiasing != activeAntialiasing || stages != activeStages) {
+            for (int g = 0; g < NUM_GROUPS; g++) {
+                folder[g].reset();
+                upsampler[g].reset();
+                decimator[g].reset();
+                linearPath[g] = false;
+            }
+            activeAntialiasing = antialiasing;
+            activeStages = stages;
+        }
+
+        if (saturator != activeSaturator) {
+            for (int g = 0; g < NUM_GROUPS; g++) {
+                clipper[g].reset();
+                softClipper[g].reset();
+            }
+            activeSaturator = saturator;
+        }
+
+        switch (activeAntialiasing) {
+            case AA_NAIVE:
+                processStages<FOLD_NAIVE, false>(channels, foldPoly, symmPoly, foldLevel, symmLevel);
+                break;
+            case AA_ADAA1:
+                processStages<FOLD_ADAA1, false>(channels, foldPoly, symmPoly, foldLevel, symmLevel);
+                break;
+            case AA_ADAA2_OVERSAMPLED:
+                processStages<FOLD_ADAA2, true>(channels, foldPoly, symmPoly, foldLevel, symmLevel);
+                break;
+            default:
+                processStages<FOLD_ADAA2, false>(channels, foldPoly, symmPoly, foldLevel, symmLevel);
+                break;
+        }
+    }
+
+    template <int Order, bool Oversample>
+    void processStages(int channels, bool foldPoly, bool symmPoly, float_4 foldLevel, float_4 symmLevel) {
+        switch (activeStages) {
+            case 1: processChannels<Order, Oversample, 1>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 2: processChannels<Order, Oversample, 2>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 3: processChannels<Order, Oversample, 3>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 5: processChannels<Order, Oversample, 5>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 6: processChannels<Order, Oversample, 6>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 7: processChannels<Order, Oversample, 7>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            case 8: processChannels<Order, Oversample, 8>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+            default: processChannels<Order, Oversample, 4>(channels, foldPoly, symmPoly, foldLevel, symmLevel); break;
+        }
+    }
+
+    template <int Order, bool Oversample, int Stages>
+    void processChannels(int channels, bool foldPoly, bool symmPoly, float_4 foldLevel, float_4 symmLevel) {
+        for (int c = 0; c < channels; c += 4) {
+            int g = c / 4;
+
             // Scale input to be within [-1 1]
-            float input = 0.2f * inputs[SIGNAL_INPUT].getVoltage(c);
+            float_4 input = 0.2f * inputs[SIGNAL_INPUT].getVoltageSimd<float_4>(c);
 
-            // Read fold cv control
-            float foldCV = inputs[FOLD_CV_INPUT].getPolyVoltage(c);
-            float foldLevel = params[FOLDS_PARAM].getValue() + 
-                            params[FOLD_ATT_PARAM].getValue() * std::abs(foldCV);
-            foldLevel = clamp(foldLevel, -10.0f, 10.0f);
+            // Polyphonic fold cv control
+            if (foldPoly) {
+                float_4 foldCV = inputs[FOLD_CV_INPUT].getVoltageSimd<float_4>(c);
+                foldLevel = knob[FOLDS_PARAM] + knob[FOLD_ATT_PARAM] * simd::abs(foldCV);
+                foldLevel = simd::clamp(foldLevel, -10.0f, 10.0f);
+            }
 
-            // Read symmetry cv control
-            float symmCV = inputs[SYMM_CV_INPUT].getPolyVoltage(c);
-            float symmLevel = params[SYMM_PARAM].getValue() + 
-                            0.5f * params[SYMM_ATT_PARAM].getValue() * symmCV;
-            symmLevel = clamp(symmLevel, -5.0f, 5.0f);
+            // Polyphonic symmetry cv control
+            if (symmPoly) {
+                float_4 symmCV = inputs[SYMM_CV_INPUT].getVoltageSimd<float_4>(c);
+                symmLevel = knob[SYMM_PARAM] + 0.5f * knob[SYMM_ATT_PARAM] * symmCV;
+                symmLevel = simd::clamp(symmLevel, -5.0f, 5.0f);
+            }
 
             // Implement wavefolders
-            float foldedOutput = input * foldLevel + symmLevel;
-            for (int i = 0; i < 4; i++) {
-                folder[c][i].process(foldedOutput);
-                foldedOutput = folder[c][i].getFoldedOutput();
+            float_4 foldedOutput = input * foldLevel + symmLevel;
+            if (Oversample) {
+                float_4 x0, x1;
+                upsampler[g].process(foldedOutput, x0, x1);
+                x0 = fold<Order, Stages>(g, x0);
+                x1 = fold<Order, Stages>(g, x1);
+                foldedOutput = decimator[g].process(x0, x1);
+            }
+            else {
+                foldedOutput = fold<Order, Stages>(g, foldedOutput);
+            }
+
+            // Take the fast path for the next block if this one, and the cascade state,
+            // stayed clear of the folding threshold
+            if (endOfBlock) {
+                float_4 peak = simd::fmax(blockPeak[g], folder[g].statePeak<Stages>());
+                linearPath[g] = !simd::movemask(peak >= linearThreshold);
+                blockPeak[g] = 0.0f;
             }
 
             // Saturator
-            clipper[c].process(foldedOutput);
-            foldedOutput = clipper[c].getClippedOutput();
+            if (activeSaturator == SATURATOR_SOFT) {
+                softClipper[g].process(foldedOutput);
+                foldedOutput = softClipper[g].getClippedOutput();
+            }
+            else {
+                clipper[g].process(foldedOutput);
+                foldedOutput = clipper[g].getClippedOutput();
+            }
+
+            if (endOfBlock && g == 0)
+                telemetry.push({5.0f * input[0], 5.0f * foldedOutput[0], foldLevel[0], symmLevel[0]});
 
             // DC blocker and output
-            dcBlocker[c].process(foldedOutput);
-            outputs[FOLDED_OUTPUT].setVoltage(5.0f * dcBlocker[c].getFilteredOutput(), c);
+            dcBlocker[g].process(foldedOutput);
+            outputs[FOLDED_OUTPUT].setVoltageSimd(5.0f * dcBlocker[g].getFilteredOutput(), c);
+        }
+    }
+
+    // Fold cascade with the linear-region fast path. Leaving the fast path rebuilds the
+    // antiderivative state first, so the first folded sample is antialiased as usual
+    template <int Order, int Stages>
+    inline float_4 fold(int g, float_4 x) {
+        blockPeak[g] = simd::fmax(blockPeak[g], simd::abs(x));
+        if (linearPath[g]) {
+            if (!simd::movemask(simd::abs(x) >= 1.0f))
+                return folder[g].processLinear<Order, Stages>(x);
+            folder[g].syncState<Order, Stages>();
+            linearPath[g] = false;
         }
+        return folder[g].process<Order, Stages>(x);
+    }
+
+    json_t* dataToJson() override {
+        json_t* rootJ = json_object();
+        json_object_set_new(rootJ, "antialiasing", json_integer(antialiasing));
+        json_object_set_new(rootJ, "stages", json_integer(stages));
+        json_object_set_new(rootJ, "saturator", json_integer(saturator));
+        return rootJ;
+    }
+
+    void dataFromJson(json_t* rootJ) override {
+        json_t* antialiasingJ = json_object_get(rootJ, "antialiasing");
+        if (antialiasingJ)
+            antialiasing = clamp((int) json_integer_value(antialiasingJ), 0, NUM_ANTIALIASING - 1);
+
+        json_t* stagesJ = json_object_get(rootJ, "stages");
+        if (stagesJ)
+            stages = clamp((int) json_integer_value(stagesJ), 1, maxStages);
+
+        json_t* saturatorJ = json_object_get(rootJ, "saturator");
+        if (saturatorJ)
+            saturator = clamp((int) json_integer_value(saturatorJ), 0, NUM_SATURATORS - 1);
     }
 
     void onSampleRateChange() override {
         sampleRate = APP->engine->getSampleRate();
-        for (int c = 0; c < MAX_POLY; c++)
-            dcBlocker[c].setSampleRate(sampleRate);
+        for (int g = 0; g < NUM_GROUPS; g++)
+            dcBlocker[g].setSampleRate(sampleRate);
+        setSmoothing();
     }
 };
 
 namespace Comps = AgaveComponents;
 
+// Live transfer curve: the static input-output curve for the current fold and symmetry
+// levels (of channel 0), with the measured operating points drawn over it
+struct TransferCurveDisplay : Comps::XYDisplay {
+    static constexpr int curvePoints = 256;
+
+    SharpWavefolder* module = nullptr;
+
+    // Settings the curve was last drawn for
+    float foldLevel = 0.0f;
+    float symmLevel = 0.0f;
+    int stages = 0;
+    int saturator = -1;
+
+    TransferCurveDisplay() {
+        curve.resize(curvePoints);
+    }
+
+    void step() override {
+        Comps::XYDisplay::step();
+        if (!module)
+            return;
+
+        SharpWavefolder::Telemetry frame = {};
+        bool received = false;
+        while (module->telemetry.pop(frame)) {
+            addPoint(Vec(frame.input, frame.output));
+            received = true;
+        }
+
+        if (received && (frame.foldLevel != foldLevel || frame.symmLevel != symmLevel))
+            updateCurve(frame.foldLevel, frame.symmLevel);
+        else if (module->activeStages != stages || module->activeSaturator != saturator)
+            updateCurve(foldLevel, symmLevel);
+    }
+
+    // Same signal path as the module, without antialiasing or the DC blocker
+    void updateCurve(float newFoldLevel, float newSymmLevel) {
+        foldLevel = newFoldLevel;
+        symmLevel = newSymmLevel;
+        stages = module->activeStages;
+        saturator = module->activeSaturator;
+
+        for (int i = 0; i < curvePoints; i++) {
+            const float x = rescale((float) i, 0.0f, curvePoints - 1, -range, range);
+            float y = 0.2f * x * foldLevel + symmLevel;
+            for (int s = 0; s < stages; s++)
+                y = Waveshaping::foldFunctionN0(y);
+            if (saturator == SharpWavefolder::SATURATOR_SOFT)
+                y = Waveshaping::softClipN0Midpoint(y, y);
+            else
+                y = Waveshaping::hardClipN0(y);
+            curve[i] = Vec(x, 5.0f * y);
+        }
+    }
+};
+
 struct SharpWavefolderWidget : ModuleWidget {
     SharpWavefolderWidget(SharpWavefolder* module) {
         setModule(module);
@@ -140,6 +422,39 @@ struct SharpWavefolderWidget : ModuleWidget {
         // OUT JACKS
         addOutput(createOutputCentered<Comps::OutputPort>(mm2px(Vec(10.16, 110.0)), module, SharpWavefolder::FOLDED_OUTPUT));
     }
+
+    void appendContextMenu(Menu* menu) override {
+        SharpWavefolder* module = dynamic_cast<SharpWavefolder*>(this->module);
+        if (!module)
+            return;
+
+        menu->addChild(new MenuSeparator);
+        menu->addChild(createIndexPtrSubmenuItem("Antialiasing", {
+            "Off (naive fold)",
+            "1st-order ADAA",
+            "2nd-order ADAA",
+            "2nd-order ADAA, 2x oversampled"
+        }, &module->antialiasing));
+        menu->addChild(createIndexSubmenuItem("Stages", {
+            "1", "2", "3", "4 (original)", "5", "6", "7", "8"
+        },
+            [=]() { return module->stages - 1; },
+            [=](int index) { module->stages = index + 1; }
+        ));
+        menu->addChild(createIndexPtrSubmenuItem("Saturator", {
+            "Hard clip",
+            "Soft clip"
+        }, &module->saturator));
+
+        menu->addChild(createSubmenuItem("Transfer curve", "", [=](Menu* menu) {
+            // Points queued while the display was closed are stale
+            module->telemetry.clear();
+            TransferCurveDisplay* display = new TransferCurveDisplay;
+            display->box.size = mm2px(Vec(40.0f, 40.0f));
+            display->module = module;
+            menu->addChild(display);
+        }));
+    }
 };
 
 Model* modelSharpWavefolder = createModel<SharpWavefolder, SharpWavefolderWidget>("SharpWavefolder");
@@ -0,0 +1,113 @@
+// BANK OF FIXED-FREQUENCY DPW SQUARE OSCILLATORS, FOUR PER float_4
+//
+// SAME WAVEFORM AS DPWSquare (SEE DPWOsc.hpp), BUT EACH LANE IS AN INDEPENDENT OSCILLATOR, AND THE
+// PHASE IS A 32-BIT FIXED-POINT ACCUMULATOR (ONE CYCLE = 2^32): IT WRAPS FOR FREE AND THE PERIOD
+// NEVER DRIFTS, WHERE A float PHASE ROUNDS EVERY INCREMENT. THE TWO SAWTOOTHS OF A SQUARE ARE
+// HALF A CYCLE APART, SO THEY SHARE THE ACCUMULATOR: WITH m1, m2 THEIR PHASES MAPPED TO [-1, 1),
+// THE SQUARE IS THE DIFFERENTIATED PARABOLA DIFFERENCE
+// 	y[n] = scale*(d[n] - d[n-1]),  d = m1^2 - m2^2,  scale = fs/(4*f0)
+// THE INCREMENTS AND SCALING FACTORS ARE PRECOMPUTED WHENEVER THE FREQUENCIES OR THE SAMPLE
+// RATE CHANGE, SO process() HAS NO DIVISIONS.
+//
+// d[n-1] STARTS AT ITS VALUE ONE SAMPLE BEFORE THE INITIAL PHASE, SO THE FIRST OUTPUT SAMPLE
+// HAS NO STARTUP SPIKE (DPWSquare STARTS FROM ZERO AND EMITS ONE OF ABOUT fs/(4*f0)).
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef DPWOSCSIMD_H
+#define DPWOSCSIMD_H
+
+#include <cmath>
+#include <cstdint>
+#include <rack.hpp>
+
+template <int N>
+class DPWSquareBankSIMD {
+
+	using float_4 = rack::simd::float_4;
+	using int32_4 = rack::simd::int32_4;
+
+public:
+
+	static constexpr int vectors = (N + 3) / 4;
+
+private:
+
+	float sampleRate = 44100.0f;
+	float f0[N] = {};
+
+	// Lanes past the last oscillator have zero increment and scale, and stay silent
+	int32_4 startPhase[vectors] = {};
+	int32_4 phase[vectors] = {};
+	int32_4 increment[vectors] = {};
+	float_4 scale[vectors] = {};
+	float_4 previous[vectors] = {};
+	float_4 output[vectors] = {};
+
+	void setCoefficients() {
+		for (int i = 0; i < 4*vectors; i++) {
+			uint32_t inc = 0;
+			float s = 0.0f;
+			if (i < N) {
+				inc = (uint32_t) std::llround((double) f0[i] / sampleRate * 4294967296.0);
+				s = sampleRate / (4.0f*f0[i]);
+			}
+			increment[i / 4][i % 4] = (int32_t) inc;
+			scale[i / 4][i % 4] = s;
+		}
+	}
+
+	// d = m1^2 - m2^2. The second sawtooth's phase (half a cycle on) read as a signed
+	// integer is 2*p2 - 1 in units of 2^31, and flipping the top bit gives the first one
+	static inline float_4 parabolaDifference(int32_4 p) noexcept {
+		const float_4 m2 = float_4(p) * (1.0f / 2147483648.0f);
+		const float_4 m1 = float_4(p ^ int32_4(INT32_MIN)) * (1.0f / 2147483648.0f);
+		return m1*m1 - m2*m2;
+	}
+
+public:
+
+	// Takes N frequencies in Hz
+	void setFrequencies(const float* frequencies, float SR) {
+		for (int i = 0; i < N; i++)
+			f0[i] = frequencies[i];
+		sampleRate = SR;
+		setCoefficients();
+		reset();
+	}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		setCoefficients();
+	}
+
+	// Takes N phases in cycles, [0, 1), used by the next reset()
+	void setStartPhases(const float* phases) {
+		for (int i = 0; i < N; i++)
+			startPhase[i / 4][i % 4] = (int32_t) (uint32_t) std::llround((double) phases[i] * 4294967296.0);
+	}
+
+	// Restarts every oscillator at its start phase (0, as a new DPWSquare, unless set)
+	void reset() {
+		for (int k = 0; k < vectors; k++) {
+			phase[k] = startPhase[k];
+			previous[k] = parabolaDifference(phase[k] - increment[k]);
+			output[k] = 0.0f;
+		}
+	}
+
+	inline void process() noexcept {
+		for (int k = 0; k < vectors; k++) {
+			const float_4 d = parabolaDifference(phase[k]);
+			output[k] = scale[k] * (d - previous[k]);
+			previous[k] = d;
+			phase[k] += increment[k];
+		}
+	}
+
+	// Oscillators 4*k to 4*k + 3
+	inline float_4 getSquareWaveforms(int k) const noexcept {
+		return output[k];
+	}
+};
+
+#endif
@@ -0,0 +1,178 @@
+// FAST APPROXIMATIONS OF TRANSCENDENTAL FUNCTIONS
+//
+// EVERY FUNCTION HAS A SCALAR (float) AND A VECTOR (float_4) FORM. THE tanh KERNELS ARE
+// FUNCTORS, SO DSP CODE CAN BE TEMPLATED ON THE KERNEL AND THE CHOICE IS MADE AT COMPILE
+// TIME. MAX ERRORS ARE MEASURED IN SINGLE PRECISION AGAINST THE std:: FUNCTIONS.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+#include <cstring>
+#include <rack.hpp>
+
+#include "LookupTables.hpp"
+
+namespace FastMath {
+
+using rack::simd::float_4;
+using rack::simd::int32_4;
+
+inline float clampSym(float x, float limit) noexcept {
+	return std::fmin(std::fmax(x, -limit), limit);
+}
+
+inline float_4 clampSym(float_4 x, float limit) noexcept {
+	return rack::simd::fmin(rack::simd::fmax(x, -limit), limit);
+}
+
+// 2^x. DEGREE-4 POLYNOMIAL ON THE FRACTIONAL PART, EXPONENT BUILT FROM THE INTEGER PART.
+// MAX RELATIVE ERROR: 3.4e-6 (0.006 CENTS). |x| <= 126.
+inline float exp2Poly(float f) noexcept {
+	return 1.0f + f*(6.9303205e-1f + f*(2.4138023e-1f + f*(5.2031539e-2f + f*1.3556178e-2f)));
+}
+
+inline float_4 exp2Poly(float_4 f) noexcept {
+	return 1.0f + f*(6.9303205e-1f + f*(2.4138023e-1f + f*(5.2031539e-2f + f*1.3556178e-2f)));
+}
+
+inline float exp2(float x) noexcept {
+	x = clampSym(x, 126.0f);
+	const float xi = std::floor(x);
+
+	const int32_t bits = ((int32_t) xi + 127) << 23;
+	float scale;
+	std::memcpy(&scale, &bits, sizeof(scale));
+
+	return exp2Poly(x - xi) * scale;
+}
+
+inline float_4 exp2(float_4 x) noexcept {
+	x = clampSym(x, 126.0f);
+	const float_4 xi = rack::simd::floor(x);
+
+	const int32_4 bits = _mm_slli_epi32((int32_4(xi) + 127).v, 23);
+
+	return exp2Poly(x - xi) * float_4::cast(bits);
+}
+
+// tan(x) FOR 0 <= x < pi/2, E.G. BILINEAR PREWARPING. [5/4] PADE APPROXIMANT.
+// MAX RELATIVE ERROR: 6e-7 FOR x < 1.07 (15 kHz AT 44.1 kHz), 3e-4 FOR x < 1.54
+template <typename T>
+inline T tan(T x) noexcept {
+	const T x2 = x*x;
+	return x*(945.0f + x2*(-105.0f + x2)) / (945.0f + x2*(-420.0f + 15.0f*x2));
+}
+
+struct TanhExact {
+// REFERENCE. THE VECTOR FORM USES tanh(x) = 1 - 2/(exp(2x) + 1)
+// MAX ERROR: 1.1e-7 (SCALAR, FLOAT ROUNDING), 1.8e-7 (VECTOR)
+
+	inline float operator()(float x) const noexcept {
+		return std::tanh(x);
+	}
+
+	inline float_4 operator()(float_4 x) const noexcept {
+		return 1.0f - 2.0f / (rack::simd::exp(2.0f * x) + 1.0f);
+	}
+};
+
+struct TanhPade {
+// [7/6] PADE APPROXIMANT (LAMBERT'S CONTINUED FRACTION), INPUT CLAMPED TO +-4.97
+// WHERE THE APPROXIMANT REACHES 1. ONE DIVISION.
+// MAX ERROR: 9.6e-5 (AT THE CLAMP), < 1e-6 FOR |x| < 3
+
+	template <typename T>
+	inline T operator()(T x) const noexcept {
+		x = clampSym(x, 4.97f);
+		const T x2 = x*x;
+		const T num = x*(135135.0f + x2*(17325.0f + x2*(378.0f + x2)));
+		const T den = 135135.0f + x2*(62370.0f + x2*(3150.0f + 28.0f*x2));
+		return num / den;
+	}
+};
+
+struct TanhPolynomial {
+// ODD DEGREE-11 POLYNOMIAL, INPUT CLAMPED TO +-3. FITTED WITH UNIT SLOPE AT 0 AND
+// VALUE 1, SLOPE 0 AT THE CLAMP, SO THE SMALL-SIGNAL GAIN IS EXACT. NO DIVISION.
+// MAX ERROR: 5.0e-3
+
+	template <typename T>
+	inline T operator()(T x) const noexcept {
+		x = clampSym(x, 3.0f);
+		const T x2 = x*x;
+		return x*(1.0f + x2*(-3.0778956e-1f + x2*(8.2739610e-2f + x2*(-1.3405204e-2f
+			+ x2*(1.1206852e-3f + x2*-3.6899723e-5f)))));
+	}
+};
+
+struct TanhSpline {
+// CUBIC HERMITE TABLE (SEE LookupTables::TanhKernel), 1 KB, NO DIVISION.
+// MAX ERROR: 2.7e-6
+
+	const LookupTables::TanhKernel* table = &LookupTables::tanhKernel();
+
+	inline float operator()(float x) const noexcept {
+		const float y = table->process(std::abs(x));
+		return (x < 0.0f) ? -y : y;
+	}
+
+	inline float_4 operator()(float_4 x) const noexcept {
+		using LookupTables::TanhKernel;
+
+		const float_4 sign = x & -0.0f;
+		float_4 absX = rack::simd::fmin(rack::simd::abs(x), TanhKernel::xMax);
+
+		const float_4 pos = absX * TanhKernel::invStep;
+		const int32_4 idx = int32_4(rack::simd::fmin(pos, float(TanhKernel::numSegments - 1)));
+		const float_4 t = (pos - float_4(idx)) * (1.0f / TanhKernel::invStep);
+
+		// One float_4 load per lane, transposed into coefficient vectors
+		__m128 c0 = _mm_loadu_ps(&table->segments[idx[0]].c0);
+		__m128 c1 = _mm_loadu_ps(&table->segments[idx[1]].c0);
+		__m128 c2 = _mm_loadu_ps(&table->segments[idx[2]].c0);
+		__m128 c3 = _mm_loadu_ps(&table->segments[idx[3]].c0);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		const float_4 a0 = c0, a1 = c1, a2 = c2, a3 = c3;
+		return (a0 + t*(a1 + t*(a2 + t*a3))) ^ sign;
+	}
+};
+
+struct DiodeSpline {
+// MS20 DIODE FEEDBACK (SEE LookupTables::DiodeKernel), VALUE AND SLOPE. x >= 0, SO CALLERS
+// APPLY WHATEVER SYMMETRY THEIR CIRCUIT HAS.
+
+	const LookupTables::DiodeKernel* table = &LookupTables::diodeKernel();
+
+	inline float operator()(float x, float& dydx) const noexcept {
+		return table->process(x, dydx);
+	}
+
+	inline float_4 operator()(float_4 x, float_4& dydx) const noexcept {
+		using LookupTables::DiodeKernel;
+
+		// (written so that NaN also saturates)
+		const float_4 inRange = x < DiodeKernel::xMax;
+		x = rack::simd::ifelse(inRange, x, DiodeKernel::xMax);
+
+		const float_4 pos = x * DiodeKernel::invStep;
+		const int32_4 idx = int32_4(rack::simd::fmin(pos, float(DiodeKernel::numSegments - 1)));
+		const float_4 t = (pos - float_4(idx)) * (1.0f / DiodeKernel::invStep);
+
+		// One float_4 load per lane, transposed into coefficient vectors
+		__m128 c0 = _mm_loadu_ps(&table->segments[idx[0]].c0);
+		__m128 c1 = _mm_loadu_ps(&table->segments[idx[1]].c0);
+		__m128 c2 = _mm_loadu_ps(&table->segments[idx[2]].c0);
+		__m128 c3 = _mm_loadu_ps(&table->segments[idx[3]].c0);
+		_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+		const float_4 a0 = c0, a1 = c1, a2 = c2, a3 = c3;
+		dydx = (a1 + t*(2.0f*a2 + 3.0f*t*a3)) & inRange;
+		return a0 + t*(a1 + t*(a2 + t*a3));
+	}
+};
+
+} // namespace FastMath
+
+#endif
@@ -0,0 +1,319 @@
+// FILTER CLASSES, FOUR VOICES AT A TIME
+//
+// SAME FILTERS AS Filters.hpp, BUT EACH LANE OF A float_4 IS AN INDEPENDENT VOICE.
+// THE COEFFICIENTS ARE SHARED BY ALL FOUR LANES.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef FILTERSSIMD_H
+#define FILTERSSIMD_H
+
+#include <algorithm>
+#include <cmath>
+#include <rack.hpp>
+
+class DCBlockerSIMD {
+
+// PEKONEN'S IIR DC BLOCKER, SEE DCBlocker
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	// Default parameters. Use constructor to overwrite.
+	float sampleRate = 44.1e3f;
+	float fc = 1.0e3f;
+
+	float_4 xState = 0.0f;
+	float_4 yState = 0.0f;
+	float p = 0.0f;
+	float gain = 0.0f;
+	float_4 output = 0.0f;
+
+public:
+
+	DCBlockerSIMD() { setPole(); }
+	DCBlockerSIMD(float cutoffFrequency, float SR) {
+		fc = cutoffFrequency;
+		sampleRate = SR;
+		setPole();
+	}
+	~DCBlockerSIMD() {}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		setPole();
+	}
+
+	void setPole() {
+		p = std::tan(0.25f*M_PI - M_PI*fc/sampleRate); // Filter pole
+		gain = 0.5f*(1.0f + p);
+	}
+
+	inline void process(float_4 input) {
+		output = gain * (input - xState + p*yState);
+
+		// Update State
+		xState = input;
+		yState = output;
+	}
+
+	inline float_4 getFilteredOutput() const noexcept {
+		return output;
+	}
+};
+
+// RCFilter as the recursion y[n] = a*y[n-1] + b*(x[n] + x[n-1]), for precomputing a and b
+inline void rcFilterCoefficients(float fc, float sampleRate, float& a, float& b) {
+	const float wa = 2.0f*M_PI*fc; // analog cutoff freq
+	const float wc = 2.0f*std::atan(0.5f*wa/sampleRate)*sampleRate; // digital cutoff freq
+	const float alpha = 2.0f*sampleRate/wc;
+	a = (alpha - 1.0f) / (alpha + 1.0f);
+	b = 1.0f / (alpha + 1.0f);
+}
+
+template <int MaxBands>
+class RCFilterBankSIMD {
+
+// UP TO MaxBands RCFilter LOWPASS SECTIONS WITH FIXED CUTOFFS, ALL FED BY THE SAME INPUT. THE
+// NUMBER OF BANDS AND THE BILINEAR COEFFICIENTS ARE SET WHENEVER THE CUTOFFS OR THE SAMPLE RATE
+// CHANGE, SO EACH SECTION COSTS A MULTIPLY AND A MULTIPLY-ADD PER SAMPLE (THE INPUT SUM
+// x[n] + x[n-1] IS SHARED) AND THE COST IS LINEAR IN THE NUMBER OF BANDS:
+// 	y[n] = a*y[n-1] + b*(x[n] + x[n-1]),  a = (alpha - 1)/(alpha + 1),  b = 1/(alpha + 1)
+// WITH alpha = 2*fs/wc AS IN RCFilter (OUTPUTS MATCH IT UP TO ROUNDING).
+//
+// ALL BANDS RUN AT THE FULL RATE, HOWEVER LOW THE CUTOFF. RUNNING THE LOW BANDS AT A REDUCED
+// RATE DOESN'T PAY WITH SECTIONS THIS CHEAP: A 2x Halfband DECIMATOR AND INTERPOLATOR COST
+// 36 ns/sample FOR 16 VOICES, AGAINST 7.5 ns/sample FOR THE 78 AND 198 Hz SECTIONS AT 96 kHz
+// (BEFORE THE DELAY THE OTHER BANDS WOULD NEED TO STAY PHASE-ALIGNED).
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	float sampleRate = 44.1e3f;
+	int bands = 0;
+	float fc[MaxBands] = {};
+
+	// Per-band coefficients, shared by all four lanes
+	float a[MaxBands] = {};
+	float b[MaxBands] = {};
+
+	float_4 previousInput = 0.0f;
+	float_4 lowpassOutput[MaxBands] = {};
+
+	void setCoefficients() {
+		for (int i = 0; i < bands; i++)
+			rcFilterCoefficients(fc[i], sampleRate, a[i], b[i]);
+	}
+
+public:
+
+	// Takes the first numBands cutoffs (at most MaxBands). Bands that are added keep their
+	// old state, so call reset() when the layout changes
+	void setCutoffs(const float* cutoffFrequencies, int numBands, float SR) {
+		bands = std::max(0, std::min(numBands, MaxBands));
+		for (int i = 0; i < bands; i++)
+			fc[i] = cutoffFrequencies[i];
+		sampleRate = SR;
+		setCoefficients();
+	}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		setCoefficients();
+	}
+
+	void reset() {
+		previousInput = 0.0f;
+		for (float_4& y : lowpassOutput)
+			y = 0.0f;
+	}
+
+	inline void process(float_4 input) noexcept {
+		// A local count: the float_4 stores could alias bands, which would be reloaded each pass
+		const float_4 s = input + previousInput;
+		const int n = bands;
+		for (int i = 0; i < n; i++)
+			lowpassOutput[i] = a[i]*lowpassOutput[i] + b[i]*s;
+		previousInput = input;
+	}
+
+	int getBands() const noexcept {
+		return bands;
+	}
+
+	inline float_4 getLowpassOutput(int band) const noexcept {
+		return lowpassOutput[band];
+	}
+};
+
+template <int MaxBands>
+class RCFilterBandsSIMD {
+
+// ONE VOICE THROUGH UP TO MaxBands RCFilter LOWPASS SECTIONS, FOUR BANDS PER float_4 (LANE k OF
+// TILE t IS BAND 4*t + k), SO THE COST IS ONE MULTIPLY AND ONE MULTIPLY-ADD PER FOUR BANDS AND
+// EACH TILE IS READY TO STORE INTO FOUR CHANNELS OF A POLYPHONIC CABLE. SAME RECURSION AS
+// RCFilterBankSIMD; LANES PAST THE LAST BAND HAVE ZERO COEFFICIENTS AND STAY SILENT.
+
+	using float_4 = rack::simd::float_4;
+
+public:
+
+	static constexpr int maxTiles = (MaxBands + 3) / 4;
+
+private:
+
+	float sampleRate = 44.1e3f;
+	int bands = 0;
+	float fc[MaxBands] = {};
+
+	// Per-lane coefficients
+	float_4 a[maxTiles] = {};
+	float_4 b[maxTiles] = {};
+
+	float previousInput = 0.0f;
+	float_4 lowpassOutput[maxTiles] = {};
+
+	void setCoefficients() {
+		for (int i = 0; i < 4*maxTiles; i++) {
+			float ai = 0.0f, bi = 0.0f;
+			if (i < bands)
+				rcFilterCoefficients(fc[i], sampleRate, ai, bi);
+			a[i / 4][i % 4] = ai;
+			b[i / 4][i % 4] = bi;
+		}
+	}
+
+public:
+
+	// Takes the first numBands cutoffs (at most MaxBands), see RCFilterBankSIMD::setCutoffs
+	void setCutoffs(const float* cutoffFrequencies, int numBands, float SR) {
+		bands = std::max(0, std::min(numBands, MaxBands));
+		for (int i = 0; i < bands; i++)
+			fc[i] = cutoffFrequencies[i];
+		sampleRate = SR;
+		setCoefficients();
+	}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		setCoefficients();
+	}
+
+	void reset() {
+		previousInput = 0.0f;
+		for (float_4& y : lowpassOutput)
+			y = 0.0f;
+	}
+
+	inline void process(float input) noexcept {
+		const float_4 s = input + previousInput;
+		const int tiles = (bands + 3) / 4;
+		for (int t = 0; t < tiles; t++)
+			lowpassOutput[t] = a[t]*lowpassOutput[t] + b[t]*s;
+		previousInput = input;
+	}
+
+	int getBands() const noexcept {
+		return bands;
+	}
+
+	// Bands 4*tile to 4*tile + 3
+	inline float_4 getLowpassOutputs(int tile) const noexcept {
+		return lowpassOutput[tile];
+	}
+};
+
+namespace Halfband {
+
+// 47-TAP HALFBAND FIR (KAISER-WINDOWED SINC, beta = 7) FOR 2x OVERSAMPLING. RIPPLE 0.003 dB
+// UP TO 0.4*fs, STOPBAND BELOW -70 dB FROM 0.6*fs (fs IS THE BASE SAMPLE RATE). EVERY
+// OTHER TAP IS ZERO AND THE CENTER TAP IS 0.5, SO EACH POLYPHASE BRANCH IS EITHER THE
+// 24-TAP SYMMETRIC FIR BELOW OR A PURE DELAY. LATENCY: 11.5 BASE-RATE SAMPLES EACH WAY.
+
+constexpr int numCoeffs = 12;
+constexpr int length = 2*numCoeffs;
+
+// Nonzero side taps, outermost first (the other half is mirrored)
+constexpr float coeffs[numCoeffs] = {
+	-8.208760425e-05f, 3.905097168e-04f, -1.070848577e-03f, 2.347397838e-03f,
+	-4.513210055e-03f, 7.952738124e-03f, -1.320476243e-02f, 2.113719900e-02f,
+	-3.346170672e-02f, 5.453258828e-02f, -1.003915687e-01f, 3.163637511e-01f
+};
+
+// Symmetric FIR over the last length inputs, newest first in x[0 .. length-1]
+inline rack::simd::float_4 convolve(const rack::simd::float_4* x) noexcept {
+	rack::simd::float_4 y = 0.0f;
+	for (int j = 0; j < numCoeffs; j++)
+		y += coeffs[j] * (x[j] + x[length - 1 - j]);
+	return y;
+}
+
+} // namespace Halfband
+
+class UpsamplerSIMD {
+
+// 2x INTERPOLATOR (SEE Halfband). EACH INPUT SAMPLE PRODUCES TWO OUTPUT SAMPLES, IN ORDER.
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	// Input history, stored twice so the window never wraps
+	float_4 history[2*Halfband::length] = {};
+	int pos = 0;
+
+public:
+
+	void reset() {
+		for (float_4& x : history)
+			x = 0.0f;
+		pos = 0;
+	}
+
+	inline void process(float_4 input, float_4& y0, float_4& y1) noexcept {
+		pos = (pos == 0) ? Halfband::length - 1 : pos - 1;
+		history[pos] = input;
+		history[pos + Halfband::length] = input;
+
+		// Zero-stuffing doubles the gain needed; the center-tap branch is a pure delay
+		y0 = 2.0f * Halfband::convolve(&history[pos]);
+		y1 = history[pos + Halfband::numCoeffs - 1];
+	}
+};
+
+class DecimatorSIMD {
+
+// 2x DECIMATOR (SEE Halfband). TAKES TWO INPUT SAMPLES, IN ORDER, PER OUTPUT SAMPLE.
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	// Histories of the two input phases, stored twice so the window never wraps
+	float_4 even[2*Halfband::length] = {};
+	float_4 odd[2*Halfband::length] = {};
+	int pos = 0;
+
+public:
+
+	void reset() {
+		for (int i = 0; i < 2*Halfband::length; i++) {
+			even[i] = 0.0f;
+			odd[i] = 0.0f;
+		}
+		pos = 0;
+	}
+
+	inline float_4 process(float_4 x0, float_4 x1) noexcept {
+		pos = (pos == 0) ? Halfband::length - 1 : pos - 1;
+		even[pos] = x0;
+		even[pos + Halfband::length] = x0;
+		odd[pos] = x1;
+		odd[pos + Halfband::length] = x1;
+
+		return Halfband::convolve(&even[pos]) + 0.5f * odd[pos + Halfband::numCoeffs];
+	}
+};
+
+#endif
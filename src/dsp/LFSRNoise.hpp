@@ -0,0 +1,61 @@
+// BIT-SLICED BANK OF 32 LFSR NOISE GENERATORS, ONE PER BIT OF A WORD
+//
+// EACH LANE (BIT POSITION) IS AN INDEPENDENT MAXIMAL-LENGTH 31-BIT FIBONACCI LFSR WITH FEEDBACK
+// POLYNOMIAL x^31 + x^28 + 1, SO ITS OUTPUT BITSTREAM REPEATS EVERY 2^31 - 1 STEPS:
+// 	b[n] = b[n-3] ^ b[n-31]
+// THE REGISTERS ARE STORED SLICED: WORD j OF THE STATE HOLDS BIT j OF EVERY LANE, SO ONE XOR OF
+// TWO WORDS ADVANCES ALL 32 LFSRs AT ONCE. THE STATE IS A CIRCULAR BUFFER OF THE LAST 31
+// OUTPUT WORDS, SO THE SHIFT IS AN INDEX UPDATE AND A STEP COSTS TWO LOADS, AN XOR AND A STORE.
+//
+// LANES ARE SEEDED AND COPIED ONE AT A TIME, WHICH TOUCHES ALL 31 WORDS.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef LFSRNOISE_H
+#define LFSRNOISE_H
+
+#include <cstdint>
+
+class LFSRNoiseBank {
+
+public:
+
+	static constexpr int length = 31;
+	static constexpr int lanes = 32;
+
+private:
+
+	static constexpr int tap = 28; // b[n-3], counted from the oldest word b[n-31]
+
+	// Oldest word at pos
+	uint32_t state[length] = {};
+	int pos = 0;
+
+public:
+
+	// Loads the low 31 bits of seed (which must not all be zero) into every lane set in mask
+	void seed(uint32_t mask, uint32_t seed) {
+		for (int j = 0; j < length; j++) {
+			uint32_t& word = state[(pos + j) % length];
+			word = ((seed >> j) & 1) ? (word | mask) : (word & ~mask);
+		}
+	}
+
+	void copyLane(int from, int to) {
+		const uint32_t mask = 1u << to;
+		for (uint32_t& word : state)
+			word = ((word >> from) & 1) ? (word | mask) : (word & ~mask);
+	}
+
+	// Steps every lane, returning their new output bits
+	inline uint32_t process() noexcept {
+		int t = pos + tap;
+		if (t >= length)
+			t -= length;
+		const uint32_t bits = state[pos] ^ state[t];
+		state[pos] = bits;
+		pos = (pos + 1 == length) ? 0 : pos + 1;
+		return bits;
+	}
+};
+
+#endif
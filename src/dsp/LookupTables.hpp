@@ -0,0 +1,152 @@
+// PLUGIN-WIDE LOOKUP TABLES
+//
+// TABLES ARE BUILT ONCE (ON FIRST USE, OR EAGERLY FROM init() IN Agave.cpp)
+// AND SHARED READ-ONLY BY EVERY MODULE INSTANCE.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef LOOKUPTABLES_H
+#define LOOKUPTABLES_H
+
+#include <array>
+#include <cmath>
+
+namespace LookupTables {
+
+struct DiodeKernel {
+// DIODE FEEDBACK NONLINEARITY OF THE MS20 FILTER (REV2). THE FEEDBACK VOLTAGE IS
+// 	y = dcGain*x + u
+// WHERE u IS THE DROP ACROSS THE DIODE CLIPPER, GIVEN IMPLICITLY BY
+// 	clipGain*x - u = Is*sinh(u/nVt)
+// 
+// THE CURVE IS STORED AS A CUBIC HERMITE SPLINE (256 SEGMENTS OVER [0, xMax], 4 KB) SO IT
+// STAYS IN L1. THE DERIVATIVE IS THE EXACT DERIVATIVE OF THE SPLINE. INPUTS ARE CLAMPED
+// TO [0, xMax], I.E. THE FEEDBACK SATURATES AT y(xMax) WITH ZERO SLOPE.
+// 
+// MAX ERROR VS. THE DIODE EQUATION: 4.1e-6 (VALUE), 3.3e-4 (SLOPE)
+
+	static constexpr int numSegments = 256;
+	static constexpr float xMax = 10.0f;
+	static constexpr float invStep = numSegments / xMax;
+
+	static constexpr double dcGain = 0.55;
+	static constexpr double clipGain = 5.0 / 3.0;
+	static constexpr double Is = 5.04e-5;
+	static constexpr double nVt = 0.078;
+
+	struct Segment {
+		float c0, c1, c2, c3;
+	};
+
+	std::array<Segment, numSegments> segments;
+
+	DiodeKernel() {
+		const double h = (double) xMax / numSegments;
+
+		double u = 0.0;
+		double y0 = 0.0, dy0 = 0.0;
+		for (int i = 0; i <= numSegments; i++) {
+			const double x = i * h;
+
+			// Newton-Raphson, warm-started from the previous knot
+			for (int iter = 0; iter < 50; iter++) {
+				const double f = clipGain*x - u - Is*std::sinh(u/nVt);
+				const double df = -1.0 - (Is/nVt)*std::cosh(u/nVt);
+				const double du = f / df;
+				u -= du;
+				if (std::abs(du) < 1.0e-12)
+					break;
+			}
+
+			const double y1 = dcGain*x + u;
+			const double dy1 = dcGain + clipGain / (1.0 + (Is/nVt)*std::cosh(u/nVt));
+
+			if (i > 0) {
+				// Hermite segment between the previous knot and this one
+				const double secant = (y1 - y0) / h;
+				segments[i-1].c0 = (float) y0;
+				segments[i-1].c1 = (float) dy0;
+				segments[i-1].c2 = (float) ((3.0*secant - 2.0*dy0 - dy1) / h);
+				segments[i-1].c3 = (float) ((dy0 + dy1 - 2.0*secant) / (h*h));
+			}
+
+			y0 = y1;
+			dy0 = dy1;
+		}
+	}
+
+	// x >= 0 (in volts). Returns y(x) and writes dy/dx.
+	inline float process(float x, float& dydx) const noexcept {
+		// (written so that NaN also saturates)
+		const bool inRange = x < xMax;
+		x = inRange ? x : xMax;
+
+		const float pos = x * invStep;
+		int idx = (int) pos;
+		idx = (idx < numSegments - 1) ? idx : numSegments - 1;
+		const float t = (pos - (float) idx) * (1.0f / invStep);
+
+		const Segment& s = segments[idx];
+		dydx = inRange ? s.c1 + t*(2.0f*s.c2 + 3.0f*t*s.c3) : 0.0f;
+		return s.c0 + t*(s.c1 + t*(s.c2 + t*s.c3));
+	}
+};
+
+inline const DiodeKernel& diodeKernel() {
+	static const DiodeKernel kernel;
+	return kernel;
+}
+
+struct TanhKernel {
+// tanh(x) STORED AS A CUBIC HERMITE SPLINE (64 SEGMENTS OVER [0, xMax], 1 KB).
+// ODD SYMMETRY IS APPLIED BY THE CALLER. INPUTS ABOVE xMAX SATURATE TO tanh(xMax).
+// 
+// MAX ERROR VS. std::tanh: 2.7e-6
+
+	static constexpr int numSegments = 64;
+	static constexpr float xMax = 8.0f;
+	static constexpr float invStep = numSegments / xMax;
+
+	struct Segment {
+		float c0, c1, c2, c3;
+	};
+
+	std::array<Segment, numSegments> segments;
+
+	TanhKernel() {
+		const double h = (double) xMax / numSegments;
+		for (int i = 0; i < numSegments; i++) {
+			const double y0 = std::tanh(i * h);
+			const double y1 = std::tanh((i + 1) * h);
+			const double dy0 = 1.0 - y0*y0;
+			const double dy1 = 1.0 - y1*y1;
+			const double secant = (y1 - y0) / h;
+
+			segments[i].c0 = (float) y0;
+			segments[i].c1 = (float) dy0;
+			segments[i].c2 = (float) ((3.0*secant - 2.0*dy0 - dy1) / h);
+			segments[i].c3 = (float) ((dy0 + dy1 - 2.0*secant) / (h*h));
+		}
+	}
+
+	// x >= 0
+	inline float process(float x) const noexcept {
+		x = (x < xMax) ? x : xMax;
+
+		const float pos = x * invStep;
+		int idx = (int) pos;
+		idx = (idx < numSegments - 1) ? idx : numSegments - 1;
+		const float t = (pos - (float) idx) * (1.0f / invStep);
+
+		const Segment& s = segments[idx];
+		return s.c0 + t*(s.c1 + t*(s.c2 + t*s.c3));
+	}
+};
+
+inline const TanhKernel& tanhKernel() {
+	static const TanhKernel kernel;
+	return kernel;
+}
+
+} // namespace LookupTables
+
+#endif
@@ -11,10 +11,19 @@
 #ifndef MS20Filter_H
 #define MS20Filter_H
 
-#include <array>
+#include <cmath>
+
+#include "LookupTables.hpp"
+#include "Newton.hpp"
 
 class MS20Filter {
 
+public:
+
+	// Newton steps taken with the full Jacobian before it is damped near the fold of the
+	// resonance loop (see Equations::evaluate). Shared with MS20FilterSIMD
+	static constexpr int fullNewtonSteps = 2;
+
 private:
 
 	float output = 0.0f;
@@ -23,14 +32,8 @@ private:
 	float sampleRate = 44100.0f;
 	float T = 1.0f/44100.0f;
 
-	// TODO: Initialize table on launch
-	const std::array<float,10001> diodeDrop = {{
-		0,0.0022156,0.0044312,0.0066468,0.0088624,0.011078,0.013294,0.015509,0.017725,0.01994,0.022156,0.024371,0.026587,0.028802,0.031018,0.033234,0.035449,0.037665,0.03988,0.042096,0.044311,0.046527,0.048742,0.050958,0.053173,0.055388,0.057604,0.059819,0.062035,0.06425,0.066465,0.068681,0.070896,0.073111,0.075327,0.077542,0.079757,0.081973,0.084188,0.086403,0.088618,0.090833,0.093048,0.095264,0.097479,0.099694,0.10191,0.10412,0.10634,0.10855,0.11077,0.11298,0.1152,0.11741,0.11963,0.12184,0.12406,0.12627,0.12849,0.1307,0.13292,0.13513,0.13735,0.13956,0.14177,0.14399,0.1462,0.14842,0.15063,0.15285,0.15506,0.15727,0.15949,0.1617,0.16392,0.16613,0.16834,0.17056,0.17277,0.17499,0.1772,0.17941,0.18163,0.18384,0.18605,0.18827,0.19048,0.19269,0.19491,0.19712,0.19933,0.20154,0.20376,0.20597,0.20818,0.2104,0.21261,0.21482,0.21703,0.21924,0.22146,0.22367,0.22588,0.22809,0.2303,0.23252,0.23473,0.23694,0.23915,0.24136,0.24357,0.24578,0.24799,0.2502,0.25242,0.25463,0.25684,0.25905,0.26126,0.26347,0.26568,0.26789,0.2701,0.2723,0.27451,0.27672,0.27893,0.28114,0.28335,0.28556,0.28777,0.28997,0.29218,0.29439,0.2966,0.2988,0.30101,0.30322,0.30542,0.30763,0.30984,0.31204,0.31425,0.31645,0.31866,0.32086,0.32307,0.32527,0.32748,0.32968,0.33188,0.33409,0.33629,0.33849,0.3407,0.3429,0.3451,0.3473,0.3495,0.3517,0.35391,0.35611,0.35831,0.36051,0.3627,0.3649,0.3671,0.3693,0.3715,0.3737,0.37589,0.37809,0.38029,0.38248,0.38468,0.38687,0.38907,0.39126,0.39345,0.39565,0.39784,0.40003,0.40222,0.40441,0.4066,0.40879,0.41098,0.41317,0.41536,0.41755,0.41973,0.42192,0.4241,0.42629,0.42847,0.43066,0.43284,0.43502,0.4372,0.43939,0.44157,0.44374,0.44592,0.4481,0.45028,0.45245,0.45463,0.4568,0.45898,0.46115,0.46332,0.46549,0.46766,0.46983,0.472,0.47417,0.47633,0.4785,0.48066,0.48283,0.48499,0.48715,0.48931,0.49147,0.49362,0.49578,0.49793,0.50009,0.50224,0.50439,0.50654,0.50869,0.51084,0.51298,0.51513,0.51727,0.51941,0.52155,0.52369,0.52583,0.52796,0.5301,0.53223,0.53436,0.53649,0.53862,0.54074,0.54287,0.54499,0.54711,0.54923,0.55134,0.55346,0.55557,0.55768,0.55979,0.56189,0.564,0.5661,0.5682,0.5703,0.5724,0.57449,0.57658,0.57867,0.58076,0.58284,0.58492,0.587,0.58908,0.59115,0.59323,0.5953,0.59736,0.59943,0.60149,0.60355,0.6056,0.60765,0.6097,0.61175,0.6138,0.61584,0.61788,0.61991,0.62194,0.62397,0.626,0.62802,0.63004,0.63206,0.63407,0.63608,0.63808,0.64009,0.64208,0.64408,0.64607,0.64806,0.65004,0.65203,0.654,0.65598,0.65795,0.65991,0.66187,0.66383,0.66578,0.66773,0.66968,0.67162,0.67356,0.67549,0.67742,0.67935,0.68127,0.68318,0.6851,0.687,0.68891,0.69081,0.6927,0.69459,0.69648,0.69836,0.70023,0.70211,0.70397,0.70584,0.70769,0.70955,0.71139,0.71324,0.71508,0.71691,0.71874,0.72056,0.72238,0.7242,0.72601,0.72781,0.72961,0.7314,0.73319,0.73498,0.73676,0.73853,0.7403,0.74206,0.74382,0.74557,0.74732,0.74907,0.7508,0.75254,0.75426,0.75599,0.7577,0.75941,0.76112,0.76282,0.76452,0.76621,0.76789,0.76958,0.77125,0.77292,0.77458,0.77624,0.7779,0.77955,0.78119,0.78283,0.78446,0.78609,0.78771,0.78933,0.79094,0.79254,0.79415,0.79574,0.79733,0.79892,0.8005,0.80207,0.80364,0.80521,0.80677,0.80832,0.80987,0.81142,0.81296,0.81449,0.81602,0.81754,0.81906,0.82058,0.82208,0.82359,0.82509,0.82658,0.82807,0.82955,0.83103,0.83251,0.83398,0.83544,0.8369,0.83836,0.83981,0.84125,0.84269,0.84413,0.84556,0.84699,0.84841,0.84982,0.85124,0.85265,0.85405,0.85545,0.85684,0.85823,0.85962,0.861,0.86237,0.86375,0.86511,0.86648,0.86784,0.86919,0.87054,0.87189,0.87323,0.87457,0.8759,0.87723,0.87856,0.87988,0.88119,0.88251,0.88382,0.88512,0.88642,0.88772,0.88901,0.8903,0.89159,0.89287,0.89415,0.89542,0.89669,0.89796,0.89922,0.90048,0.90173,0.90298,0.90423,0.90548,0.90672,0.90795,0.90919,0.91042,0.91164,0.91287,0.91409,0.9153,0.91652,0.91772,0.91893,0.92013,0.92133,0.92253,0.92372,0.92491,0.9261,0.92728,0.92846,0.92964,0.93081,0.93198,0.93315,0.93431,0.93547,0.93663,0.93779,0.93894,0.94009,0.94124,0.94238,0.94352,0.94466,0.94579,0.94692,0.94805,0.94918,0.9503,0.95142,0.95254,0.95366,0.95477,0.95588,0.95699,0.95809,0.9592,0.9603,0.96139,0.96249,0.96358,0.96467,0.96575,0.96684,0.96792,0.969,0.97008,0.97115,0.97222,0.97329,0.97436,0.97543,0.97649,0.97755,0.97861,0.97966,0.98072,0.98177,0.98282,0.98386,0.98491,0.98595,0.98699,0.98803,0.98906,0.9901,0.99113,0.99216,0.99318,0.99421,0.99523,0.99625,0.99727,0.99829,0.99931,1.0003,1.0013,1.0023,1.0033,1.0044,1.0054,1.0064,1.0074,1.0084,1.0093,1.0103,1.0113,1.0123,1.0133,1.0143,1.0153,1.0163,1.0172,1.0182,1.0192,1.0202,1.0212,1.0221,1.0231,1.0241,1.025,1.026,1.027,1.0279,1.0289,1.0298,1.0308,1.0318,1.0327,1.0337,1.0346,1.0356,1.0365,1.0375,1.0384,1.0394,1.0403,1.0412,1.0422,1.0431,1.044,1.045,1.0459,1.0468,1.0478,1.0487,1.0496,1.0506,1.0515,1.0524,1.0533,1.0543,1.0552,1.0561,1.057,1.0579,1.0588,1.0597,1.0607,1.0616,1.0625,1.0634,1.0643,1.0652,1.0661,1.067,1.0679,1.0688,1.0697,1.0706,1.0715,1.0724,1.0733,1.0742,1.0751,1.076,1.0768,1.0777,1.0786,1.0795,1.0804,1.0813,1.0822,1.083,1.0839,1.0848,1.0857,1.0865,1.0874,1.0883,1.0892,1.09,1.0909,1.0918,1.0926,1.0935,1.0944,1.0952,1.0961,1.097,1.0978,1.0987,1.0996,1.1004,1.1013,1.1021,1.103,1.1038,1.1047,1.1056,1.1064,1.1073,1.1081,1.109,1.1098,1.1107,1.1115,1.1124,1.1132,1.114,1.1149,1.1157,1.1166,1.1174,1.1182,1.1191,1.1199,1.1208,1.1216,1.1224,1.1233,1.1241,1.1249,1.1258,1.1266,1.1274,1.1283,1.1291,1.1299,1.1307,1.1316,1.1324,1.1332,1.134,1.1349,1.1357,1.1365,1.1373,1.1381,1.139,1.1398,1.1406,1.1414,1.1422,1.143,1.1439,1.1447,1.1455,1.1463,1.1471,1.1479,1.1487,1.1495,1.1504,1.1512,1.152,1.1528,1.1536,1.1544,1.1552,1.156,1.1568,1.1576,1.1584,1.1592,1.16,1.1608,1.1616,1.1624,1.1632,1.164,1.1648,1.1656,1.1664,1.1672,1.168,1.1688,1.1695,1.1703,1.1711,1.1719,1.1727,1.1735,1.1743,1.1751,1.1759,1.1766,1.1774,1.1782,1.179,1.1798,1.1806,1.1814,1.1821,1.1829,1.1837,1.1845,1.1853,1.186,1.1868,1.1876,1.1884,1.1891,1.1899,1.1907,1.1915,1.1923,1.193,1.1938,1.1946,1.1953,1.1961,1.1969,1.1977,1.1984,1.1992,1.2,1.2007,1.2015,1.2023,1.203,1.2038,1.2046,1.2053,1.2061,1.2069,1.2076,1.2084,1.2092,1.2099,1.2107,1.2114,1.2122,1.213,1.2137,1.2145,1.2152,1.216,1.2168,1.2175,1.2183,1.219,1.2198,1.2205,1.2213,1.2221,1.2228,1.2236,1.2243,1.2251,1.2258,1.2266,1.2273,1.2281,1.2288,1.2296,1.2303,1.2311,1.2318,1.2326,1.2333,1.2341,1.2348,1.2356,1.2363,1.237,1.2378,1.2385,1.2393,1.24,1.2408,1.2415,1.2423,1.243,1.2437,1.2445,1.2452,1.246,1.2467,1.2474,1.2482,1.2489,1.2497,1.2504,1.2511,1.2519,1.2526,1.2533,1.2541,1.2548,1.2556,1.2563,1.257,1.2578,1.2585,1.2592,1.26,1.2607,1.2614,1.2622,1.2629,1.2636,1.2643,1.2651,1.2658,1.2665,1.2673,1.268,1.2687,1.2695,1.2702,1.2709,1.2716,1.2724,1.2731,1.2738,1.2745,1.2753,1.276,1.2767,1.2774,1.2782,1.2789,1.2796,1.2803,1.2811,1.2818,1.2825,1.2832,1.2839,1.2847,1.2854,1.2861,1.2868,1.2875,1.2883,1.289,1.2897,1.2904,1.2911,1.2919,1.2926,1.2933,1.294,1.2947,1.2954,1.2962,1.2969,1.2976,1.2983,1.299,1.2997,1.3004,1.3012,1.3019,1.3026,1.3033,1.304,1.3047,1.3054,1.3061,1.3068,1.3076,1.3083,1.309,1.3097,1.3104,1.3111,1.3118,1.3125,1.3132,1.3139,1.3146,1.3154,1.3161,1.3168,1.3175,1.3182,1.3189,1.3196,1.3203,1.321,1.3217,1.3224,1.3231,1.3238,1.3245,1.3252,1.3259,1.3266,1.3273,1.328,1.3287,1.3294,1.3301,1.3308,1.3316,1.3323,1.333,1.3337,1.3344,1.3351,1.3358,1.3365,1.3371,1.3378,1.3385,1.3392,1.3399,1.3406,1.3413,1.342,1.3427,1.3434,1.3441,1.3448,1.3455,1.3462,1.3469,1.3476,1.3483,1.349,1.3497,1.3504,1.3511,1.3518,1.3525,1.3532,1.3538,1.3545,1.3552,1.3559,1.3566,1.3573,1.358,1.3587,1.3594,1.3601,1.3608,1.3615,1.3621,1.3628,1.3635,1.3642,1.3649,1.3656,1.3663,1.367,1.3677,1.3683,1.369,1.3697,1.3704,1.3711,1.3718,1.3725,1.3732,1.3738,1.3745,1.3752,1.3759,1.3766,1.3773,1.378,1.3786,1.3793,1.38,1.3807,1.3814,1.3821,1.3827,1.3834,1.3841,1.3848,1.3855,1.3862,1.3868,1.3875,1.3882,1.3889,1.3896,1.3903,1.3909,1.3916,1.3923,1.393,1.3937,1.3943,1.395,1.3957,1.3964,1.3971,1.3977,1.3984,1.3991,1.3998,1.4005,1.4011,1.4018,1.4025,1.4032,1.4038,1.4045,1.4052,1.4059,1.4065,1.4072,1.4079,1.4086,1.4093,1.4099,1.4106,1.4113,1.412,1.4126,1.4133,1.414,1.4147,1.4153,1.416,1.4167,1.4173,1.418,1.4187,1.4194,1.42,1.4207,1.4214,1.4221,1.4227,1.4234,1.4241,1.4247,1.4254,1.4261,1.4268,1.4274,1.4281,1.4288,1.4294,1.4301,1.4308,1.4315,1.4321,1.4328,1.4335,1.4341,1.4348,1.4355,1.4361,1.4368,1.4375,1.4381,1.4388,1.4395,1.4401,1.4408,1.4415,1.4421,1.4428,1.4435,1.4441,1.4448,1.4455,1.4461,1.4468,1.4475,1.4481,1.4488,1.4495,1.4501,1.4508,1.4515,1.4521,1.4528,1.4535,1.4541,1.4548,1.4555,1.4561,1.4568,1.4574,1.4581,1.4588,1.4594,1.4601,1.4608,1.4614,1.4621,1.4628,1.4634,1.4641,1.4647,1.4654,1.4661,1.4667,1.4674,1.468,1.4687,1.4694,1.47,1.4707,1.4713,1.472,1.4727,1.4733,1.474,1.4746,1.4753,1.476,1.4766,1.4773,1.4779,1.4786,1.4793,1.4799,1.4806,1.4812,1.4819,1.4826,1.4832,1.4839,1.4845,1.4852,1.4858,1.4865,1.4872,1.4878,1.4885,1.4891,1.4898,1.4904,1.4911,1.4918,1.4924,1.4931,1.4937,1.4944,1.495,1.4957,1.4963,1.497,1.4977,1.4983,1.499,1.4996,1.5003,1.5009,1.5016,1.5022,1.5029,1.5035,1.5042,1.5048,1.5055,1.5062,1.5068,1.5075,1.5081,1.5088,1.5094,1.5101,1.5107,1.5114,1.512,1.5127,1.5133,1.514,1.5146,1.5153,1.5159,1.5166,1.5172,1.5179,1.5185,1.5192,1.5198,1.5205,1.5211,1.5218,1.5224,1.5231,1.5237,1.5244,1.525,1.5257,1.5263,1.527,1.5276,1.5283,1.5289,1.5296,1.5302,1.5309,1.5315,1.5322,1.5328,1.5335,1.5341,1.5348,1.5354,1.5361,1.5367,1.5374,1.538,1.5387,1.5393,1.5399,1.5406,1.5412,1.5419,1.5425,1.5432,1.5438,1.5445,1.5451,1.5458,1.5464,1.5471,1.5477,1.5483,1.549,1.5496,1.5503,1.5509,1.5516,1.5522,1.5529,1.5535,1.5542,1.5548,1.5554,1.5561,1.5567,1.5574,1.558,1.5587,1.5593,1.5599,1.5606,1.5612,1.5619,1.5625,1.5632,1.5638,1.5644,1.5651,1.5657,1.5664,1.567,1.5677,1.5683,1.5689,1.5696,1.5702,1.5709,1.5715,1.5722,1.5728,1.5734,1.5741,1.5747,1.5754,1.576,1.5766,1.5773,1.5779,1.5786,1.5792,1.5798,1.5805,1.5811,1.5818,1.5824,1.583,1.5837,1.5843,1.585,1.5856,1.5862,1.5869,1.5875,1.5882,1.5888,1.5894,1.5901,1.5907,1.5914,1.592,1.5926,1.5933,1.5939,1.5945,1.5952,1.5958,1.5965,1.5971,1.5977,1.5984,1.599,1.5996,1.6003,1.6009,1.6016,1.6022,1.6028,1.6035,1.6041,1.6047,1.6054,1.606,1.6067,1.6073,1.6079,1.6086,1.6092,1.6098,1.6105,1.6111,1.6117,1.6124,1.613,1.6136,1.6143,1.6149,1.6156,1.6162,1.6168,1.6175,1.6181,1.6187,1.6194,1.62,1.6206,1.6213,1.6219,1.6225,1.6232,1.6238,1.6244,1.6251,1.6257,1.6263,1.627,1.6276,1.6282,1.6289,1.6295,1.6301,1.6308,1.6314,1.632,1.6327,1.6333,1.6339,1.6346,1.6352,1.6358,1.6365,1.6371,1.6377,1.6384,1.639,1.6396,1.6403,1.6409,1.6415,1.6422,1.6428,1.6434,1.644,1.6447,1.6453,1.6459,1.6466,1.6472,1.6478,1.6485,1.6491,1.6497,1.6504,1.651,1.6516,1.6522,1.6529,1.6535,1.6541,1.6548,1.6554,1.656,1.6567,1.6573,1.6579,1.6585,1.6592,1.6598,1.6604,1.6611,1.6617,1.6623,1.6629,1.6636,1.6642,1.6648,1.6655,1.6661,1.6667,1.6673,1.668,1.6686,1.6692,1.6699,1.6705,1.6711,1.6717,1.6724,1.673,1.6736,1.6743,1.6749,1.6755,1.6761,1.6768,1.6774,1.678,1.6786,1.6793,1.6799,1.6805,1.6812,1.6818,1.6824,1.683,1.6837,1.6843,1.6849,1.6855,1.6862,1.6868,1.6874,1.688,1.6887,1.6893,1.6899,1.6905,1.6912,1.6918,1.6924,1.6931,1.6937,1.6943,1.6949,1.6956,1.6962,1.6968,1.6974,1.6981,1.6987,1.6993,1.6999,1.7006,1.7012,1.7018,1.7024,1.703,1.7037,1.7043,1.7049,1.7055,1.7062,1.7068,1.7074,1.708,1.7087,1.7093,1.7099,1.7105,1.7112,1.7118,1.7124,1.713,1.7137,1.7143,1.7149,1.7155,1.7161,1.7168,1.7174,1.718,1.7186,1.7193,1.7199,1.7205,1.7211,1.7217,1.7224,1.723,1.7236,1.7242,1.7249,1.7255,1.7261,1.7267,1.7273,1.728,1.7286,1.7292,1.7298,1.7305,1.7311,1.7317,1.7323,1.7329,1.7336,1.7342,1.7348,1.7354,1.736,1.7367,1.7373,1.7379,1.7385,1.7392,1.7398,1.7404,1.741,1.7416,1.7423,1.7429,1.7435,1.7441,1.7447,1.7454,1.746,1.7466,1.7472,1.7478,1.7485,1.7491,1.7497,1.7503,1.7509,1.7516,1.7522,1.7528,1.7534,1.754,1.7546,1.7553,1.7559,1.7565,1.7571,1.7577,1.7584,1.759,1.7596,1.7602,1.7608,1.7615,1.7621,1.7627,1.7633,1.7639,1.7645,1.7652,1.7658,1.7664,1.767,1.7676,1.7683,1.7689,1.7695,1.7701,1.7707,1.7713,1.772,1.7726,1.7732,1.7738,1.7744,1.775,1.7757,1.7763,1.7769,1.7775,1.7781,1.7787,1.7794,1.78,1.7806,1.7812,1.7818,1.7824,1.7831,1.7837,1.7843,1.7849,1.7855,1.7861,1.7868,1.7874,1.788,1.7886,1.7892,1.7898,1.7905,1.7911,1.7917,1.7923,1.7929,1.7935,1.7942,1.7948,1.7954,1.796,1.7966,1.7972,1.7978,1.7985,1.7991,1.7997,1.8003,1.8009,1.8015,1.8022,1.8028,1.8034,1.804,1.8046,1.8052,1.8058,1.8065,1.8071,1.8077,1.8083,1.8089,1.8095,1.8101,1.8108,1.8114,1.812,1.8126,1.8132,1.8138,1.8144,1.8151,1.8157,1.8163,1.8169,1.8175,1.8181,1.8187,1.8193,1.82,1.8206,1.8212,1.8218,1.8224,1.823,1.8236,1.8243,1.8249,1.8255,1.8261,1.8267,1.8273,1.8279,1.8285,1.8292,1.8298,1.8304,1.831,1.8316,1.8322,1.8328,1.8334,1.8341,1.8347,1.8353,1.8359,1.8365,1.8371,1.8377,1.8383,1.839,1.8396,1.8402,1.8408,1.8414,1.842,1.8426,1.8432,1.8438,1.8445,1.8451,1.8457,1.8463,1.8469,1.8475,1.8481,1.8487,1.8493,1.85,1.8506,1.8512,1.8518,1.8524,1.853,1.8536,1.8542,1.8548,1.8555,1.8561,1.8567,1.8573,1.8579,1.8585,1.8591,1.8597,1.8603,1.861,1.8616,1.8622,1.8628,1.8634,1.864,1.8646,1.8652,1.8658,1.8664,1.8671,1.8677,1.8683,1.8689,1.8695,1.8701,1.8707,1.8713,1.8719,1.8725,1.8731,1.8738,1.8744,1.875,1.8756,1.8762,1.8768,1.8774,1.878,1.8786,1.8792,1.8798,1.8805,1.8811,1.8817,1.8823,1.8829,1.8835,1.8841,1.8847,1.8853,1.8859,1.8865,1.8872,1.8878,1.8884,1.889,1.8896,1.8902,1.8908,1.8914,1.892,1.8926,1.8932,1.8938,1.8944,1.8951,1.8957,1.8963,1.8969,1.8975,1.8981,1.8987,1.8993,1.8999,1.9005,1.9011,1.9017,1.9023,1.903,1.9036,1.9042,1.9048,1.9054,1.906,1.9066,1.9072,1.9078,1.9084,1.909,1.9096,1.9102,1.9108,1.9115,1.9121,1.9127,1.9133,1.9139,1.9145,1.9151,1.9157,1.9163,1.9169,1.9175,1.9181,1.9187,1.9193,1.9199,1.9205,1.9212,1.9218,1.9224,1.923,1.9236,1.9242,1.9248,1.9254,1.926,1.9266,1.9272,1.9278,1.9284,1.929,1.9296,1.9302,1.9308,1.9315,1.9321,1.9327,1.9333,1.9339,1.9345,1.9351,1.9357,1.9363,1.9369,1.9375,1.9381,1.9387,1.9393,1.9399,1.9405,1.9411,1.9417,1.9423,1.9429,1.9436,1.9442,1.9448,1.9454,1.946,1.9466,1.9472,1.9478,1.9484,1.949,1.9496,1.9502,1.9508,1.9514,1.952,1.9526,1.9532,1.9538,1.9544,1.955,1.9556,1.9562,1.9568,1.9575,1.9581,1.9587,1.9593,1.9599,1.9605,1.9611,1.9617,1.9623,1.9629,1.9635,1.9641,1.9647,1.9653,1.9659,1.9665,1.9671,1.9677,1.9683,1.9689,1.9695,1.9701,1.9707,1.9713,1.9719,1.9725,1.9731,1.9737,1.9743,1.9749,1.9756,1.9762,1.9768,1.9774,1.978,1.9786,1.9792,1.9798,1.9804,1.981,1.9816,1.9822,1.9828,1.9834,1.984,1.9846,1.9852,1.9858,1.9864,1.987,1.9876,1.9882,1.9888,1.9894,1.99,1.9906,1.9912,1.9918,1.9924,1.993,1.9936,1.9942,1.9948,1.9954,1.996,1.9966,1.9972,1.9978,1.9984,1.999,1.9996,2.0002,2.0008,2.0014,2.002,2.0026,2.0032,2.0038,2.0044,2.005,2.0056,2.0062,2.0069,2.0075,2.0081,2.0087,2.0093,2.0099,2.0105,2.0111,2.0117,2.0123,2.0129,2.0135,2.0141,2.0147,2.0153,2.0159,2.0165,2.0171,2.0177,2.0183,2.0189,2.0195,2.0201,2.0207,2.0213,2.0219,2.0225,2.0231,2.0237,2.0243,2.0249,2.0255,2.0261,2.0267,2.0273,2.0279,2.0285,2.0291,2.0297,2.0303,2.0309,2.0315,2.0321,2.0327,2.0333,2.0339,2.0345,2.0351,2.0357,2.0363,2.0369,2.0375,2.0381,2.0387,2.0393,2.0399,2.0405,2.0411,2.0417,2.0423,2.0429,2.0435,2.0441,2.0447,2.0453,2.0459,2.0465,2.0471,2.0476,2.0482,2.0488,2.0494,2.05,2.0506,2.0512,2.0518,2.0524,2.053,2.0536,2.0542,2.0548,2.0554,2.056,2.0566,2.0572,2.0578,2.0584,2.059,2.0596,2.0602,2.0608,2.0614,2.062,2.0626,2.0632,2.0638,2.0644,2.065,2.0656,2.0662,2.0668,2.0674,2.068,2.0686,2.0692,2.0698,2.0704,2.071,2.0716,2.0722,2.0728,2.0734,2.074,2.0746,2.0752,2.0758,2.0764,2.077,2.0776,2.0782,2.0788,2.0794,2.0799,2.0805,2.0811,2.0817,2.0823,2.0829,2.0835,2.0841,2.0847,2.0853,2.0859,2.0865,2.0871,2.0877,2.0883,2.0889,2.0895,2.0901,2.0907,2.0913,2.0919,2.0925,2.0931,2.0937,2.0943,2.0949,2.0955,2.0961,2.0967,2.0973,2.0979,2.0985,2.0991,2.0996,2.1002,2.1008,2.1014,2.102,2.1026,2.1032,2.1038,2.1044,2.105,2.1056,2.1062,2.1068,2.1074,2.108,2.1086,2.1092,2.1098,2.1104,2.111,2.1116,2.1122,2.1128,2.1134,2.114,2.1146,2.1151,2.1157,2.1163,2.1169,2.1175,2.1181,2.1187,2.1193,2.1199,2.1205,2.1211,2.1217,2.1223,2.1229,2.1235,2.1241,2.1247,2.1253,2.1259,2.1265,2.1271,2.1277,2.1282,2.1288,2.1294,2.13,2.1306,2.1312,2.1318,2.1324,2.133,2.1336,2.1342,2.1348,2.1354,2.136,2.1366,2.1372,2.1378,2.1384,2.139,2.1396,2.1401,2.1407,2.1413,2.1419,2.1425,2.1431,2.1437,2.1443,2.1449,2.1455,2.1461,2.1467,2.1473,2.1479,2.1485,2.1491,2.1497,2.1503,2.1508,2.1514,2.152,2.1526,2.1532,2.1538,2.1544,2.155,2.1556,2.1562,2.1568,2.1574,2.158,2.1586,2.1592,2.1598,2.1604,2.1609,2.1615,2.1621,2.1627,2.1633,2.1639,2.1645,2.1651,2.1657,2.1663,2.1669,2.1675,2.1681,2.1687,2.1693,2.1699,2.1704,2.171,2.1716,2.1722,2.1728,2.1734,2.174,2.1746,2.1752,2.1758,2.1764,2.177,2.1776,2.1782,2.1788,2.1793,2.1799,2.1805,2.1811,2.1817,2.1823,2.1829,2.1835,2.1841,2.1847,2.1853,2.1859,2.1865,2.1871,2.1876,2.1882,2.1888,2.1894,2.19,2.1906,2.1912,2.1918,2.1924,2.193,2.1936,2.1942,2.1948,2.1954,2.1959,2.1965,2.1971,2.1977,2.1983,2.1989,2.1995,2.2001,2.2007,2.2013,2.2019,2.2025,2.2031,2.2036,2.2042,2.2048,2.2054,2.206,2.2066,2.2072,2.2078,2.2084,2.209,2.2096,2.2102,2.2107,2.2113,2.2119,2.2125,2.2131,2.2137,2.2143,2.2149,2.2155,2.2161,2.2167,2.2173,2.2178,2.2184,2.219,2.2196,2.2202,2.2208,2.2214,2.222,2.2226,2.2232,2.2238,2.2244,2.2249,2.2255,2.2261,2.2267,2.2273,2.2279,2.2285,2.2291,2.2297,2.2303,2.2309,2.2315,2.232,2.2326,2.2332,2.2338,2.2344,2.235,2.2356,2.2362,2.2368,2.2374,2.238,2.2385,2.2391,2.2397,2.2403,2.2409,2.2415,2.2421,2.2427,2.2433,2.2439,2.2445,2.245,2.2456,2.2462,2.2468,2.2474,2.248,2.2486,2.2492,2.2498,2.2504,2.2509,2.2515,2.2521,2.2527,2.2533,2.2539,2.2545,2.2551,2.2557,2.2563,2.2569,2.2574,2.258,2.2586,2.2592,2.2598,2.2604,2.261,2.2616,2.2622,2.2628,2.2633,2.2639,2.2645,2.2651,2.2657,2.2663,2.2669,2.2675,2.2681,2.2687,2.2692,2.2698,2.2704,2.271,2.2716,2.2722,2.2728,2.2734,2.274,2.2746,2.2751,2.2757,2.2763,2.2769,2.2775,2.2781,2.2787,2.2793,2.2799,2.2804,2.281,2.2816,2.2822,2.2828,2.2834,2.284,2.2846,2.2852,2.2858,2.2863,2.2869,2.2875,2.2881,2.2887,2.2893,2.2899,2.2905,2.2911,2.2916,2.2922,2.2928,2.2934,2.294,2.2946,2.2952,2.2958,2.2964,2.2969,2.2975,2.2981,2.2987,2.2993,2.2999,2.3005,2.3011,2.3017,2.3022,2.3028,2.3034,2.304,2.3046,2.3052,2.3058,2.3064,2.307,2.3075,2.3081,2.3087,2.3093,2.3099,2.3105,2.3111,2.3117,2.3123,2.3128,2.3134,2.314,2.3146,2.3152,2.3158,2.3164,2.317,2.3175,2.3181,2.3187,2.3193,2.3199,2.3205,2.3211,2.3217,2.3223,2.3228,2.3234,2.324,2.3246,2.3252,2.3258,2.3264,2.327,2.3275,2.3281,2.3287,2.3293,2.3299,2.3305,2.3311,2.3317,2.3322,2.3328,2.3334,2.334,2.3346,2.3352,2.3358,2.3364,2.337,2.3375,2.3381,2.3387,2.3393,2.3399,2.3405,2.3411,2.3417,2.3422,2.3428,2.3434,2.344,2.3446,2.3452,2.3458,2.3464,2.3469,2.3475,2.3481,2.3487,2.3493,2.3499,2.3505,2.3511,2.3516,2.3522,2.3528,2.3534,2.354,2.3546,2.3552,2.3557,2.3563,2.3569,2.3575,2.3581,2.3587,2.3593,2.3599,2.3604,2.361,2.3616,2.3622,2.3628,2.3634,2.364,2.3646,2.3651,2.3657,2.3663,2.3669,2.3675,2.3681,2.3687,2.3692,2.3698,2.3704,2.371,2.3716,2.3722,2.3728,2.3734,2.3739,2.3745,2.3751,2.3757,2.3763,2.3769,2.3775,2.378,2.3786,2.3792,2.3798,2.3804,2.381,2.3816,2.3822,2.3827,2.3833,2.3839,2.3845,2.3851,2.3857,2.3863,2.3868,2.3874,2.388,2.3886,2.3892,2.3898,2.3904,2.3909,2.3915,2.3921,2.3927,2.3933,2.3939,2.3945,2.395,2.3956,2.3962,2.3968,2.3974,2.398,2.3986,2.3992,2.3997,2.4003,2.4009,2.4015,2.4021,2.4027,2.4033,2.4038,2.4044,2.405,2.4056,2.4062,2.4068,2.4074,2.4079,2.4085,2.4091,2.4097,2.4103,2.4109,2.4115,2.412,2.4126,2.4132,2.4138,2.4144,2.415,2.4155,2.4161,2.4167,2.4173,2.4179,2.4185,2.4191,2.4196,2.4202,2.4208,2.4214,2.422,2.4226,2.4232,2.4237,2.4243,2.4249,2.4255,2.4261,2.4267,2.4273,2.4278,2.4284,2.429,2.4296,2.4302,2.4308,2.4314,2.4319,2.4325,2.4331,2.4337,2.4343,2.4349,2.4354,2.436,2.4366,2.4372,2.4378,2.4384,2.439,2.4395,2.4401,2.4407,2.4413,2.4419,2.4425,2.443,2.4436,2.4442,2.4448,2.4454,2.446,2.4466,2.4471,2.4477,2.4483,2.4489,2.4495,2.4501,2.4506,2.4512,2.4518,2.4524,2.453,2.4536,2.4542,2.4547,2.4553,2.4559,2.4565,2.4571,2.4577,2.4582,2.4588,2.4594,2.46,2.4606,2.4612,2.4618,2.4623,2.4629,2.4635,2.4641,2.4647,2.4653,2.4658,2.4664,2.467,2.4676,2.4682,2.4688,2.4693,2.4699,2.4705,2.4711,2.4717,2.4723,2.4728,2.4734,2.474,2.4746,2.4752,2.4758,2.4764,2.4769,2.4775,2.4781,2.4787,2.4793,2.4799,2.4804,2.481,2.4816,2.4822,2.4828,2.4834,2.4839,2.4845,2.4851,2.4857,2.4863,2.4869,2.4874,2.488,2.4886,2.4892,2.4898,2.4904,2.4909,2.4915,2.4921,2.4927,2.4933,2.4939,2.4944,2.495,2.4956,2.4962,2.4968,2.4974,2.4979,2.4985,2.4991,2.4997,2.5003,2.5009,2.5014,2.502,2.5026,2.5032,2.5038,2.5044,2.5049,2.5055,2.5061,2.5067,2.5073,2.5079,2.5084,2.509,2.5096,2.5102,2.5108,2.5114,2.5119,2.5125,2.5131,2.5137,2.5143,2.5149,2.5154,2.516,2.5166,2.5172,2.5178,2.5184,2.5189,2.5195,2.5201,2.5207,2.5213,2.5219,2.5224,2.523,2.5236,2.5242,2.5248,2.5253,2.5259,2.5265,2.5271,2.5277,2.5283,2.5288,2.5294,2.53,2.5306,2.5312,2.5318,2.5323,2.5329,2.5335,2.5341,2.5347,2.5353,2.5358,2.5364,2.537,2.5376,2.5382,2.5387,2.5393,2.5399,2.5405,2.5411,2.5417,2.5422,2.5428,2.5434,2.544,2.5446,2.5452,2.5457,2.5463,2.5469,2.5475,2.5481,2.5486,2.5492,2.5498,2.5504,2.551,2.5516,2.5521,2.5527,2.5533,2.5539,2.5545,2.555,2.5556,2.5562,2.5568,2.5574,2.558,2.5585,2.5591,2.5597,2.5603,2.5609,2.5615,2.562,2.5626,2.5632,2.5638,2.5644,2.5649,2.5655,2.5661,2.5667,2.5673,2.5679,2.5684,2.569,2.5696,2.5702,2.5708,2.5713,2.5719,2.5725,2.5731,2.5737,2.5743,2.5748,2.5754,2.576,2.5766,2.5772,2.5777,2.5783,2.5789,2.5795,2.5801,2.5806,2.5812,2.5818,2.5824,2.583,2.5836,2.5841,2.5847,2.5853,2.5859,2.5865,2.587,2.5876,2.5882,2.5888,2.5894,2.5899,2.5905,2.5911,2.5917,2.5923,2.5929,2.5934,2.594,2.5946,2.5952,2.5958,2.5963,2.5969,2.5975,2.5981,2.5987,2.5992,2.5998,2.6004,2.601,2.6016,2.6022,2.6027,2.6033,2.6039,2.6045,2.6051,2.6056,2.6062,2.6068,2.6074,2.608,2.6085,2.6091,2.6097,2.6103,2.6109,2.6114,2.612,2.6126,2.6132,2.6138,2.6144,2.6149,2.6155,2.6161,2.6167,2.6173,2.6178,2.6184,2.619,2.6196,2.6202,2.6207,2.6213,2.6219,2.6225,2.6231,2.6236,2.6242,2.6248,2.6254,2.626,2.6265,2.6271,2.6277,2.6283,2.6289,2.6294,2.63,2.6306,2.6312,2.6318,2.6324,2.6329,2.6335,2.6341,2.6347,2.6353,2.6358,2.6364,2.637,2.6376,2.6382,2.6387,2.6393,2.6399,2.6405,2.6411,2.6416,2.6422,2.6428,2.6434,2.644,2.6445,2.6451,2.6457,2.6463,2.6469,2.6474,2.648,2.6486,2.6492,2.6498,2.6503,2.6509,2.6515,2.6521,2.6527,2.6532,2.6538,2.6544,2.655,2.6556,2.6561,2.6567,2.6573,2.6579,2.6585,2.659,2.6596,2.6602,2.6608,2.6614,2.6619,2.6625,2.6631,2.6637,2.6643,2.6648,2.6654,2.666,2.6666,2.6672,2.6677,2.6683,2.6689,2.6695,2.6701,2.6706,2.6712,2.6718,2.6724,2.673,2.6735,2.6741,2.6747,2.6753,2.6758,2.6764,2.677,2.6776,2.6782,2.6787,2.6793,2.6799,2.6805,2.6811,2.6816,2.6822,2.6828,2.6834,2.684,2.6845,2.6851,2.6857,2.6863,2.6869,2.6874,2.688,2.6886,2.6892,2.6898,2.6903,2.6909,2.6915,2.6921,2.6927,2.6932,2.6938,2.6944,2.695,2.6955,2.6961,2.6967,2.6973,2.6979,2.6984,2.699,2.6996,2.7002,2.7008,2.7013,2.7019,2.7025,2.7031,2.7037,2.7042,2.7048,2.7054,2.706,2.7066,2.7071,2.7077,2.7083,2.7089,2.7094,2.71,2.7106,2.7112,2.7118,2.7123,2.7129,2.7135,2.7141,2.7147,2.7152,2.7158,2.7164,2.717,2.7175,2.7181,2.7187,2.7193,2.7199,2.7204,2.721,2.7216,2.7222,2.7228,2.7233,2.7239,2.7245,2.7251,2.7257,2.7262,2.7268,2.7274,2.728,2.7285,2.7291,2.7297,2.7303,2.7309,2.7314,2.732,2.7326,2.7332,2.7338,2.7343,2.7349,2.7355,2.7361,2.7366,2.7372,2.7378,2.7384,2.739,2.7395,2.7401,2.7407,2.7413,2.7418,2.7424,2.743,2.7436,2.7442,2.7447,2.7453,2.7459,2.7465,2.7471,2.7476,2.7482,2.7488,2.7494,2.7499,2.7505,2.7511,2.7517,2.7523,2.7528,2.7534,2.754,2.7546,2.7551,2.7557,2.7563,2.7569,2.7575,2.758,2.7586,2.7592,2.7598,2.7604,2.7609,2.7615,2.7621,2.7627,2.7632,2.7638,2.7644,2.765,2.7656,2.7661,2.7667,2.7673,2.7679,2.7684,2.769,2.7696,2.7702,2.7708,2.7713,2.7719,2.7725,2.7731,2.7736,2.7742,2.7748,2.7754,2.776,2.7765,2.7771,2.7777,2.7783,2.7788,2.7794,2.78,2.7806,2.7812,2.7817,2.7823,2.7829,2.7835,2.784,2.7846,2.7852,2.7858,2.7864,2.7869,2.7875,2.7881,2.7887,2.7892,2.7898,2.7904,2.791,2.7916,2.7921,2.7927,2.7933,2.7939,2.7944,2.795,2.7956,2.7962,2.7967,2.7973,2.7979,2.7985,2.7991,2.7996,2.8002,2.8008,2.8014,2.8019,2.8025,2.8031,2.8037,2.8043,2.8048,2.8054,2.806,2.8066,2.8071,2.8077,2.8083,2.8089,2.8094,2.81,2.8106,2.8112,2.8118,2.8123,2.8129,2.8135,2.8141,2.8146,2.8152,2.8158,2.8164,2.817,2.8175,2.8181,2.8187,2.8193,2.8198,2.8204,2.821,2.8216,2.8221,2.8227,2.8233,2.8239,2.8245,2.825,2.8256,2.8262,2.8268,2.8273,2.8279,2.8285,2.8291,2.8296,2.8302,2.8308,2.8314,2.832,2.8325,2.8331,2.8337,2.8343,2.8348,2.8354,2.836,2.8366,2.8371,2.8377,2.8383,2.8389,2.8395,2.84,2.8406,2.8412,2.8418,2.8423,2.8429,2.8435,2.8441,2.8446,2.8452,2.8458,2.8464,2.8469,2.8475,2.8481,2.8487,2.8493,2.8498,2.8504,2.851,2.8516,2.8521,2.8527,2.8533,2.8539,2.8544,2.855,2.8556,2.8562,2.8568,2.8573,2.8579,2.8585,2.8591,2.8596,2.8602,2.8608,2.8614,2.8619,2.8625,2.8631,2.8637,2.8642,2.8648,2.8654,2.866,2.8665,2.8671,2.8677,2.8683,2.8689,2.8694,2.87,2.8706,2.8712,2.8717,2.8723,2.8729,2.8735,2.874,2.8746,2.8752,2.8758,2.8763,2.8769,2.8775,2.8781,2.8786,2.8792,2.8798,2.8804,2.881,2.8815,2.8821,2.8827,2.8833,2.8838,2.8844,2.885,2.8856,2.8861,2.8867,2.8873,2.8879,2.8884,2.889,2.8896,2.8902,2.8907,2.8913,2.8919,2.8925,2.8931,2.8936,2.8942,2.8948,2.8954,2.8959,2.8965,2.8971,2.8977,2.8982,2.8988,2.8994,2.9,2.9005,2.9011,2.9017,2.9023,2.9028,2.9034,2.904,2.9046,2.9051,2.9057,2.9063,2.9069,2.9074,2.908,2.9086,2.9092,2.9097,2.9103,2.9109,2.9115,2.9121,2.9126,2.9132,2.9138,2.9144,2.9149,2.9155,2.9161,2.9167,2.9172,2.9178,2.9184,2.919,2.9195,2.9201,2.9207,2.9213,2.9218,2.9224,2.923,2.9236,2.9241,2.9247,2.9253,2.9259,2.9264,2.927,2.9276,2.9282,2.9287,2.9293,2.9299,2.9305,2.931,2.9316,2.9322,2.9328,2.9333,2.9339,2.9345,2.9351,2.9356,2.9362,2.9368,2.9374,2.9379,2.9385,2.9391,2.9397,2.9402,2.9408,2.9414,2.942,2.9425,2.9431,2.9437,2.9443,2.9449,2.9454,2.946,2.9466,2.9472,2.9477,2.9483,2.9489,2.9495,2.95,2.9506,2.9512,2.9518,2.9523,2.9529,2.9535,2.9541,2.9546,2.9552,2.9558,2.9564,2.9569,2.9575,2.9581,2.9587,2.9592,2.9598,2.9604,2.961,2.9615,2.9621,2.9627,2.9633,2.9638,2.9644,2.965,2.9656,2.9661,2.9667,2.9673,2.9679,2.9684,2.969,2.9696,2.9702,2.9707,2.9713,2.9719,2.9725,2.973,2.9736,2.9742,2.9747,2.9753,2.9759,2.9765,2.977,2.9776,2.9782,2.9788,2.9793,2.9799,2.9805,2.9811,2.9816,2.9822,2.9828,2.9834,2.9839,2.9845,2.9851,2.9857,2.9862,2.9868,2.9874,2.988,2.9885,2.9891,2.9897,2.9903,2.9908,2.9914,2.992,2.9926,2.9931,2.9937,2.9943,2.9949,2.9954,2.996,2.9966,2.9972,2.9977,2.9983,2.9989,2.9995,3,3.0006,3.0012,3.0018,3.0023,3.0029,3.0035,3.0041,3.0046,3.0052,3.0058,3.0064,3.0069,3.0075,3.0081,3.0086,3.0092,3.0098,3.0104,3.0109,3.0115,3.0121,3.0127,3.0132,3.0138,3.0144,3.015,3.0155,3.0161,3.0167,3.0173,3.0178,3.0184,3.019,3.0196,3.0201,3.0207,3.0213,3.0219,3.0224,3.023,3.0236,3.0242,3.0247,3.0253,3.0259,3.0264,3.027,3.0276,3.0282,3.0287,3.0293,3.0299,3.0305,3.031,3.0316,3.0322,3.0328,3.0333,3.0339,3.0345,3.0351,3.0356,3.0362,3.0368,3.0374,3.0379,3.0385,3.0391,3.0397,3.0402,3.0408,3.0414,3.0419,3.0425,3.0431,3.0437,3.0442,3.0448,3.0454,3.046,3.0465,3.0471,3.0477,3.0483,3.0488,3.0494,3.05,3.0506,3.0511,3.0517,3.0523,3.0528,3.0534,3.054,3.0546,3.0551,3.0557,3.0563,3.0569,3.0574,3.058,3.0586,3.0592,3.0597,3.0603,3.0609,3.0615,3.062,3.0626,3.0632,3.0637,3.0643,3.0649,3.0655,3.066,3.0666,3.0672,3.0678,3.0683,3.0689,3.0695,3.0701,3.0706,3.0712,3.0718,3.0724,3.0729,3.0735,3.0741,3.0746,3.0752,3.0758,3.0764,3.0769,3.0775,3.0781,3.0787,3.0792,3.0798,3.0804,3.081,3.0815,3.0821,3.0827,3.0832,3.0838,3.0844,3.085,3.0855,3.0861,3.0867,3.0873,3.0878,3.0884,3.089,3.0896,3.0901,3.0907,3.0913,3.0918,3.0924,3.093,3.0936,3.0941,3.0947,3.0953,3.0959,3.0964,3.097,3.0976,3.0982,3.0987,3.0993,3.0999,3.1004,3.101,3.1016,3.1022,3.1027,3.1033,3.1039,3.1045,3.105,3.1056,3.1062,3.1068,3.1073,3.1079,3.1085,3.109,3.1096,3.1102,3.1108,3.1113,3.1119,3.1125,3.1131,3.1136,3.1142,3.1148,3.1153,3.1159,3.1165,3.1171,3.1176,3.1182,3.1188,3.1194,3.1199,3.1205,3.1211,3.1217,3.1222,3.1228,3.1234,3.1239,3.1245,3.1251,3.1257,3.1262,3.1268,3.1274,3.128,3.1285,3.1291,3.1297,3.1302,3.1308,3.1314,3.132,3.1325,3.1331,3.1337,3.1343,3.1348,3.1354,3.136,3.1365,3.1371,3.1377,3.1383,3.1388,3.1394,3.14,3.1406,3.1411,3.1417,3.1423,3.1428,3.1434,3.144,3.1446,3.1451,3.1457,3.1463,3.1469,3.1474,3.148,3.1486,3.1491,3.1497,3.1503,3.1509,3.1514,3.152,3.1526,3.1532,3.1537,3.1543,3.1549,3.1554,3.156,3.1566,3.1572,3.1577,3.1583,3.1589,3.1594,3.16,3.1606,3.1612,3.1617,3.1623,3.1629,3.1635,3.164,3.1646,3.1652,3.1657,3.1663,3.1669,3.1675,3.168,3.1686,3.1692,3.1698,3.1703,3.1709,3.1715,3.172,3.1726,3.1732,3.1738,3.1743,3.1749,3.1755,3.176,3.1766,3.1772,3.1778,3.1783,3.1789,3.1795,3.1801,3.1806,3.1812,3.1818,3.1823,3.1829,3.1835,3.1841,3.1846,3.1852,3.1858,3.1864,3.1869,3.1875,3.1881,3.1886,3.1892,3.1898,3.1904,3.1909,3.1915,3.1921,3.1926,3.1932,3.1938,3.1944,3.1949,3.1955,3.1961,3.1966,3.1972,3.1978,3.1984,3.1989,3.1995,3.2001,3.2007,3.2012,3.2018,3.2024,3.2029,3.2035,3.2041,3.2047,3.2052,3.2058,3.2064,3.2069,3.2075,3.2081,3.2087,3.2092,3.2098,3.2104,3.2109,3.2115,3.2121,3.2127,3.2132,3.2138,3.2144,3.215,3.2155,3.2161,3.2167,3.2172,3.2178,3.2184,3.219,3.2195,3.2201,3.2207,3.2212,3.2218,3.2224,3.223,3.2235,3.2241,3.2247,3.2252,3.2258,3.2264,3.227,3.2275,3.2281,3.2287,3.2292,3.2298,3.2304,3.231,3.2315,3.2321,3.2327,3.2333,3.2338,3.2344,3.235,3.2355,3.2361,3.2367,3.2373,3.2378,3.2384,3.239,3.2395,3.2401,3.2407,3.2413,3.2418,3.2424,3.243,3.2435,3.2441,3.2447,3.2453,3.2458,3.2464,3.247,3.2475,3.2481,3.2487,3.2493,3.2498,3.2504,3.251,3.2515,3.2521,3.2527,3.2533,3.2538,3.2544,3.255,3.2555,3.2561,3.2567,3.2573,3.2578,3.2584,3.259,3.2595,3.2601,3.2607,3.2613,3.2618,3.2624,3.263,3.2635,3.2641,3.2647,3.2653,3.2658,3.2664,3.267,3.2675,3.2681,3.2687,3.2693,3.2698,3.2704,3.271,3.2715,3.2721,3.2727,3.2733,3.2738,3.2744,3.275,3.2755,3.2761,3.2767,3.2773,3.2778,3.2784,3.279,3.2795,3.2801,3.2807,3.2813,3.2818,3.2824,3.283,3.2835,3.2841,3.2847,3.2853,3.2858,3.2864,3.287,3.2875,3.2881,3.2887,3.2893,3.2898,3.2904,3.291,3.2915,3.2921,3.2927,3.2932,3.2938,3.2944,3.295,3.2955,3.2961,3.2967,3.2972,3.2978,3.2984,3.299,3.2995,3.3001,3.3007,3.3012,3.3018,3.3024,3.303,3.3035,3.3041,3.3047,3.3052,3.3058,3.3064,3.307,3.3075,3.3081,3.3087,3.3092,3.3098,3.3104,3.3109,3.3115,3.3121,3.3127,3.3132,3.3138,3.3144,3.3149,3.3155,3.3161,3.3167,3.3172,3.3178,3.3184,3.3189,3.3195,3.3201,3.3207,3.3212,3.3218,3.3224,3.3229,3.3235,3.3241,3.3247,3.3252,3.3258,3.3264,3.3269,3.3275,3.3281,3.3286,3.3292,3.3298,3.3304,3.3309,3.3315,3.3321,3.3326,3.3332,3.3338,3.3344,3.3349,3.3355,3.3361,3.3366,3.3372,3.3378,3.3383,3.3389,3.3395,3.3401,3.3406,3.3412,3.3418,3.3423,3.3429,3.3435,3.3441,3.3446,3.3452,3.3458,3.3463,3.3469,3.3475,3.348,3.3486,3.3492,3.3498,3.3503,3.3509,3.3515,3.352,3.3526,3.3532,3.3538,3.3543,3.3549,3.3555,3.356,3.3566,3.3572,3.3577,3.3583,3.3589,3.3595,3.36,3.3606,3.3612,3.3617,3.3623,3.3629,3.3635,3.364,3.3646,3.3652,3.3657,3.3663,3.3669,3.3674,3.368,3.3686,3.3692,3.3697,3.3703,3.3709,3.3714,3.372,3.3726,3.3731,3.3737,3.3743,3.3749,3.3754,3.376,3.3766,3.3771,3.3777,3.3783,3.3789,3.3794,3.38,3.3806,3.3811,3.3817,3.3823,3.3828,3.3834,3.384,3.3846,3.3851,3.3857,3.3863,3.3868,3.3874,3.388,3.3885,3.3891,3.3897,3.3903,3.3908,3.3914,3.392,3.3925,3.3931,3.3937,3.3942,3.3948,3.3954,3.396,3.3965,3.3971,3.3977,3.3982,3.3988,3.3994,3.3999,3.4005,3.4011,3.4017,3.4022,3.4028,3.4034,3.4039,3.4045,3.4051,3.4056,3.4062,3.4068,3.4074,3.4079,3.4085,3.4091,3.4096,3.4102,3.4108,3.4113,3.4119,3.4125,3.4131,3.4136,3.4142,3.4148,3.4153,3.4159,3.4165,3.417,3.4176,3.4182,3.4188,3.4193,3.4199,3.4205,3.421,3.4216,3.4222,3.4227,3.4233,3.4239,3.4245,3.425,3.4256,3.4262,3.4267,3.4273,3.4279,3.4284,3.429,3.4296,3.4302,3.4307,3.4313,3.4319,3.4324,3.433,3.4336,3.4341,3.4347,3.4353,3.4359,3.4364,3.437,3.4376,3.4381,3.4387,3.4393,3.4398,3.4404,3.441,3.4416,3.4421,3.4427,3.4433,3.4438,3.4444,3.445,3.4455,3.4461,3.4467,3.4472,3.4478,3.4484,3.449,3.4495,3.4501,3.4507,3.4512,3.4518,3.4524,3.4529,3.4535,3.4541,3.4547,3.4552,3.4558,3.4564,3.4569,3.4575,3.4581,3.4586,3.4592,3.4598,3.4604,3.4609,3.4615,3.4621,3.4626,3.4632,3.4638,3.4643,3.4649,3.4655,3.466,3.4666,3.4672,3.4678,3.4683,3.4689,3.4695,3.47,3.4706,3.4712,3.4717,3.4723,3.4729,3.4734,3.474,3.4746,3.4752,3.4757,3.4763,3.4769,3.4774,3.478,3.4786,3.4791,3.4797,3.4803,3.4809,3.4814,3.482,3.4826,3.4831,3.4837,3.4843,3.4848,3.4854,3.486,3.4865,3.4871,3.4877,3.4883,3.4888,3.4894,3.49,3.4905,3.4911,3.4917,3.4922,3.4928,3.4934,3.4939,3.4945,3.4951,3.4957,3.4962,3.4968,3.4974,3.4979,3.4985,3.4991,3.4996,3.5002,3.5008,3.5013,3.5019,3.5025,3.5031,3.5036,3.5042,3.5048,3.5053,3.5059,3.5065,3.507,3.5076,3.5082,3.5087,3.5093,3.5099,3.5105,3.511,3.5116,3.5122,3.5127,3.5133,3.5139,3.5144,3.515,3.5156,3.5161,3.5167,3.5173,3.5179,3.5184,3.519,3.5196,3.5201,3.5207,3.5213,3.5218,3.5224,3.523,3.5235,3.5241,3.5247,3.5252,3.5258,3.5264,3.527,3.5275,3.5281,3.5287,3.5292,3.5298,3.5304,3.5309,3.5315,3.5321,3.5326,3.5332,3.5338,3.5344,3.5349,3.5355,3.5361,3.5366,3.5372,3.5378,3.5383,3.5389,3.5395,3.54,3.5406,3.5412,3.5417,3.5423,3.5429,3.5435,3.544,3.5446,3.5452,3.5457,3.5463,3.5469,3.5474,3.548,3.5486,3.5491,3.5497,3.5503,3.5509,3.5514,3.552,3.5526,3.5531,3.5537,3.5543,3.5548,3.5554,3.556,3.5565,3.5571,3.5577,3.5582,3.5588,3.5594,3.56,3.5605,3.5611,3.5617,3.5622,3.5628,3.5634,3.5639,3.5645,3.5651,3.5656,3.5662,3.5668,3.5673,3.5679,3.5685,3.5691,3.5696,3.5702,3.5708,3.5713,3.5719,3.5725,3.573,3.5736,3.5742,3.5747,3.5753,3.5759,3.5764,3.577,3.5776,3.5782,3.5787,3.5793,3.5799,3.5804,3.581,3.5816,3.5821,3.5827,3.5833,3.5838,3.5844,3.585,3.5855,3.5861,3.5867,3.5872,3.5878,3.5884,3.589,3.5895,3.5901,3.5907,3.5912,3.5918,3.5924,3.5929,3.5935,3.5941,3.5946,3.5952,3.5958,3.5963,3.5969,3.5975,3.598,3.5986,3.5992,3.5998,3.6003,3.6009,3.6015,3.602,3.6026,3.6032,3.6037,3.6043,3.6049,3.6054,3.606,3.6066,3.6071,3.6077,3.6083,3.6088,3.6094,3.61,3.6106,3.6111,3.6117,3.6123,3.6128,3.6134,3.614,3.6145,3.6151,3.6157,3.6162,3.6168,3.6174,3.6179,3.6185,3.6191,3.6196,3.6202,3.6208,3.6214,3.6219,3.6225,3.6231,3.6236,3.6242,3.6248,3.6253,3.6259,3.6265,3.627,3.6276,3.6282,3.6287,3.6293,3.6299,3.6304,3.631,3.6316,3.6321,3.6327,3.6333,3.6339,3.6344,3.635,3.6356,3.6361,3.6367,3.6373,3.6378,3.6384,3.639,3.6395,3.6401,3.6407,3.6412,3.6418,3.6424,3.6429,3.6435,3.6441,3.6446,3.6452,3.6458,3.6464,3.6469,3.6475,3.6481,3.6486,3.6492,3.6498,3.6503,3.6509,3.6515,3.652,3.6526,3.6532,3.6537,3.6543,3.6549,3.6554,3.656,3.6566,3.6571,3.6577,3.6583,3.6588,3.6594,3.66,3.6606,3.6611,3.6617,3.6623,3.6628,3.6634,3.664,3.6645,3.6651,3.6657,3.6662,3.6668,3.6674,3.6679,3.6685,3.6691,3.6696,3.6702,3.6708,3.6713,3.6719,3.6725,3.673,3.6736,3.6742,3.6748,3.6753,3.6759,3.6765,3.677,3.6776,3.6782,3.6787,3.6793,3.6799,3.6804,3.681,3.6816,3.6821,3.6827,3.6833,3.6838,3.6844,3.685,3.6855,3.6861,3.6867,3.6872,3.6878,3.6884,3.6889,3.6895,3.6901,3.6907,3.6912,3.6918,3.6924,3.6929,3.6935,3.6941,3.6946,3.6952,3.6958,3.6963,3.6969,3.6975,3.698,3.6986,3.6992,3.6997,3.7003,3.7009,3.7014,3.702,3.7026,3.7031,3.7037,3.7043,3.7048,3.7054,3.706,3.7065,3.7071,3.7077,3.7083,3.7088,3.7094,3.71,3.7105,3.7111,3.7117,3.7122,3.7128,3.7134,3.7139,3.7145,3.7151,3.7156,3.7162,3.7168,3.7173,3.7179,3.7185,3.719,3.7196,3.7202,3.7207,3.7213,3.7219,3.7224,3.723,3.7236,3.7241,3.7247,3.7253,3.7258,3.7264,3.727,3.7275,3.7281,3.7287,3.7293,3.7298,3.7304,3.731,3.7315,3.7321,3.7327,3.7332,3.7338,3.7344,3.7349,3.7355,3.7361,3.7366,3.7372,3.7378,3.7383,3.7389,3.7395,3.74,3.7406,3.7412,3.7417,3.7423,3.7429,3.7434,3.744,3.7446,3.7451,3.7457,3.7463,3.7468,3.7474,3.748,3.7485,3.7491,3.7497,3.7502,3.7508,3.7514,3.7519,3.7525,3.7531,3.7537,3.7542,3.7548,3.7554,3.7559,3.7565,3.7571,3.7576,3.7582,3.7588,3.7593,3.7599,3.7605,3.761,3.7616,3.7622,3.7627,3.7633,3.7639,3.7644,3.765,3.7656,3.7661,3.7667,3.7673,3.7678,3.7684,3.769,3.7695,3.7701,3.7707,3.7712,3.7718,3.7724,3.7729,3.7735,3.7741,3.7746,3.7752,3.7758,3.7763,3.7769,3.7775,3.778,3.7786,3.7792,3.7797,3.7803,3.7809,3.7814,3.782,3.7826,3.7831,3.7837,3.7843,3.7848,3.7854,3.786,3.7866,3.7871,3.7877,3.7883,3.7888,3.7894,3.79,3.7905,3.7911,3.7917,3.7922,3.7928,3.7934,3.7939,3.7945,3.7951,3.7956,3.7962,3.7968,3.7973,3.7979,3.7985,3.799,3.7996,3.8002,3.8007,3.8013,3.8019,3.8024,3.803,3.8036,3.8041,3.8047,3.8053,3.8058,3.8064,3.807,3.8075,3.8081,3.8087,3.8092,3.8098,3.8104,3.8109,3.8115,3.8121,3.8126,3.8132,3.8138,3.8143,3.8149,3.8155,3.816,3.8166,3.8172,3.8177,3.8183,3.8189,3.8194,3.82,3.8206,3.8211,3.8217,3.8223,3.8228,3.8234,3.824,3.8245,3.8251,3.8257,3.8262,3.8268,3.8274,3.8279,3.8285,3.8291,3.8296,3.8302,3.8308,3.8313,3.8319,3.8325,3.833,3.8336,3.8342,3.8347,3.8353,3.8359,3.8364,3.837,3.8376,3.8381,3.8387,3.8393,3.8398,3.8404,3.841,3.8415,3.8421,3.8427,3.8432,3.8438,3.8444,3.8449,3.8455,3.8461,3.8466,3.8472,3.8478,3.8483,3.8489,3.8495,3.85,3.8506,3.8512,3.8517,3.8523,3.8529,3.8534,3.854,3.8546,3.8551,3.8557,3.8563,3.8568,3.8574,3.858,3.8585,3.8591,3.8597,3.8602,3.8608,3.8614,3.8619,3.8625,3.8631,3.8636,3.8642,3.8648,3.8653,3.8659,3.8665,3.867,3.8676,3.8682,3.8687,3.8693,3.8699,3.8704,3.871,3.8716,3.8721,3.8727,3.8733,3.8738,3.8744,3.875,3.8755,3.8761,3.8767,3.8772,3.8778,3.8784,3.8789,3.8795,3.8801,3.8806,3.8812,3.8818,3.8823,3.8829,3.8835,3.884,3.8846,3.8852,3.8857,3.8863,3.8869,3.8874,3.888,3.8886,3.8891,3.8897,3.8903,3.8908,3.8914,3.892,3.8925,3.8931,3.8937,3.8942,3.8948,3.8954,3.8959,3.8965,3.8971,3.8976,3.8982,3.8988,3.8993,3.8999,3.9005,3.901,3.9016,3.9022,3.9027,3.9033,3.9039,3.9044,3.905,3.9056,3.9061,3.9067,3.9073,3.9078,3.9084,3.909,3.9095,3.9101,3.9107,3.9112,3.9118,3.9124,3.9129,3.9135,3.9141,3.9146,3.9152,3.9158,3.9163,3.9169,3.9175,3.918,3.9186,3.9192,3.9197,3.9203,3.9209,3.9214,3.922,3.9226,3.9231,3.9237,3.9243,3.9248,3.9254,3.926,3.9265,3.9271,3.9277,3.9282,3.9288,3.9294,3.9299,3.9305,3.9311,3.9316,3.9322,3.9328,3.9333,3.9339,3.9344,3.935,3.9356,3.9361,3.9367,3.9373,3.9378,3.9384,3.939,3.9395,3.9401,3.9407,3.9412,3.9418,3.9424,3.9429,3.9435,3.9441,3.9446,3.9452,3.9458,3.9463,3.9469,3.9475,3.948,3.9486,3.9492,3.9497,3.9503,3.9509,3.9514,3.952,3.9526,3.9531,3.9537,3.9543,3.9548,3.9554,3.956,3.9565,3.9571,3.9577,3.9582,3.9588,3.9594,3.9599,3.9605,3.9611,3.9616,3.9622,3.9628,3.9633,3.9639,3.9645,3.965,3.9656,3.9662,3.9667,3.9673,3.9678,3.9684,3.969,3.9695,3.9701,3.9707,3.9712,3.9718,3.9724,3.9729,3.9735,3.9741,3.9746,3.9752,3.9758,3.9763,3.9769,3.9775,3.978,3.9786,3.9792,3.9797,3.9803,3.9809,3.9814,3.982,3.9826,3.9831,3.9837,3.9843,3.9848,3.9854,3.986,3.9865,3.9871,3.9877,3.9882,3.9888,3.9894,3.9899,3.9905,3.9911,3.9916,3.9922,3.9928,3.9933,3.9939,3.9944,3.995,3.9956,3.9961,3.9967,3.9973,3.9978,3.9984,3.999,3.9995,4.0001,4.0007,4.0012,4.0018,4.0024,4.0029,4.0035,4.0041,4.0046,4.0052,4.0058,4.0063,4.0069,4.0075,4.008,4.0086,4.0092,4.0097,4.0103,4.0109,4.0114,4.012,4.0126,4.0131,4.0137,4.0143,4.0148,4.0154,4.0159,4.0165,4.0171,4.0176,4.0182,4.0188,4.0193,4.0199,4.0205,4.021,4.0216,4.0222,4.0227,4.0233,4.0239,4.0244,4.025,4.0256,4.0261,4.0267,4.0273,4.0278,4.0284,4.029,4.0295,4.0301,4.0307,4.0312,4.0318,4.0324,4.0329,4.0335,4.0341,4.0346,4.0352,4.0357,4.0363,4.0369,4.0374,4.038,4.0386,4.0391,4.0397,4.0403,4.0408,4.0414,4.042,4.0425,4.0431,4.0437,4.0442,4.0448,4.0454,4.0459,4.0465,4.0471,4.0476,4.0482,4.0488,4.0493,4.0499,4.0505,4.051,4.0516,4.0522,4.0527,4.0533,4.0538,4.0544,4.055,4.0555,4.0561,4.0567,4.0572,4.0578,4.0584,4.0589,4.0595,4.0601,4.0606,4.0612,4.0618,4.0623,4.0629,4.0635,4.064,4.0646,4.0652,4.0657,4.0663,4.0669,4.0674,4.068,4.0685,4.0691,4.0697,4.0702,4.0708,4.0714,4.0719,4.0725,4.0731,4.0736,4.0742,4.0748,4.0753,4.0759,4.0765,4.077,4.0776,4.0782,4.0787,4.0793,4.0799,4.0804,4.081,4.0816,4.0821,4.0827,4.0833,4.0838,4.0844,4.0849,4.0855,4.0861,4.0866,4.0872,4.0878,4.0883,4.0889,4.0895,4.09,4.0906,4.0912,4.0917,4.0923,4.0929,4.0934,4.094,4.0946,4.0951,4.0957,4.0963,4.0968,4.0974,4.0979,4.0985,4.0991,4.0996,4.1002,4.1008,4.1013,4.1019,4.1025,4.103,4.1036,4.1042,4.1047,4.1053,4.1059,4.1064,4.107,4.1076,4.1081,4.1087,4.1093,4.1098,4.1104,4.111,4.1115,4.1121,4.1126,4.1132,4.1138,4.1143,4.1149,4.1155,4.116,4.1166,4.1172,4.1177,4.1183,4.1189,4.1194,4.12,4.1206,4.1211,4.1217,4.1223,4.1228,4.1234,4.124,4.1245,4.1251,4.1256,4.1262,4.1268,4.1273,4.1279,4.1285,4.129,4.1296,4.1302,4.1307,4.1313,4.1319,4.1324,4.133,4.1336,4.1341,4.1347,4.1353,4.1358,4.1364,4.1369,4.1375,4.1381,4.1386,4.1392,4.1398,4.1403,4.1409,4.1415,4.142,4.1426,4.1432,4.1437,4.1443,4.1449,4.1454,4.146,4.1466,4.1471,4.1477,4.1482,4.1488,4.1494,4.1499,4.1505,4.1511,4.1516,4.1522,4.1528,4.1533,4.1539,4.1545,4.155,4.1556,4.1562,4.1567,4.1573,4.1579,4.1584,4.159,4.1595,4.1601,4.1607,4.1612,4.1618,4.1624,4.1629,4.1635,4.1641,4.1646,4.1652,4.1658,4.1663,4.1669,4.1675,4.168,4.1686,4.1692,4.1697,4.1703,4.1708,4.1714,4.172,4.1725,4.1731,4.1737,4.1742,4.1748,4.1754,4.1759,4.1765,4.1771,4.1776,4.1782,4.1788,4.1793,4.1799,4.1805,4.181,4.1816,4.1821,4.1827,4.1833,4.1838,4.1844,4.185,4.1855,4.1861,4.1867,4.1872,4.1878,4.1884,4.1889,4.1895,4.1901,4.1906,4.1912,4.1917,4.1923,4.1929,4.1934,4.194,4.1946,4.1951,4.1957,4.1963,4.1968,4.1974,4.198,4.1985,4.1991,4.1997,4.2002,4.2008,4.2014,4.2019,4.2025,4.203,4.2036,4.2042,4.2047,4.2053,4.2059,4.2064,4.207,4.2076,4.2081,4.2087,4.2093,4.2098,4.2104,4.211,4.2115,4.2121,4.2126,4.2132,4.2138,4.2143,4.2149,4.2155,4.216,4.2166,4.2172,4.2177,4.2183,4.2189,4.2194,4.22,4.2206,4.2211,4.2217,4.2222,4.2228,4.2234,4.2239,4.2245,4.2251,4.2256,4.2262,4.2268,4.2273,4.2279,4.2285,4.229,4.2296,4.2302,4.2307,4.2313,4.2318,4.2324,4.233,4.2335,4.2341,4.2347,4.2352,4.2358,4.2364,4.2369,4.2375,4.2381,4.2386,4.2392,4.2397,4.2403,4.2409,4.2414,4.242,4.2426,4.2431,4.2437,4.2443,4.2448,4.2454,4.246,4.2465,4.2471,4.2477,4.2482,4.2488,4.2493,4.2499,4.2505,4.251,4.2516,4.2522,4.2527,4.2533,4.2539,4.2544,4.255,4.2556,4.2561,4.2567,4.2572,4.2578,4.2584,4.2589,4.2595,4.2601,4.2606,4.2612,4.2618,4.2623,4.2629,4.2635,4.264,4.2646,4.2652,4.2657,4.2663,4.2668,4.2674,4.268,4.2685,4.2691,4.2697,4.2702,4.2708,4.2714,4.2719,4.2725,4.2731,4.2736,4.2742,4.2747,4.2753,4.2759,4.2764,4.277,4.2776,4.2781,4.2787,4.2793,4.2798,4.2804,4.281,4.2815,4.2821,4.2826,4.2832,4.2838,4.2843,4.2849,4.2855,4.286,4.2866,4.2872,4.2877,4.2883,4.2889,4.2894,4.29,4.2906,4.2911,4.2917,4.2922,4.2928,4.2934,4.2939,4.2945,4.2951,4.2956,4.2962,4.2968,4.2973,4.2979,4.2985,4.299,4.2996,4.3001,4.3007,4.3013,4.3018,4.3024,4.303,4.3035,4.3041,4.3047,4.3052,4.3058,4.3064,4.3069,4.3075,4.308,4.3086,4.3092,4.3097,4.3103,4.3109,4.3114,4.312,4.3126,4.3131,4.3137,4.3143,4.3148,4.3154,4.3159,4.3165,4.3171,4.3176,4.3182,4.3188,4.3193,4.3199,4.3205,4.321,4.3216,4.3222,4.3227,4.3233,4.3238,4.3244,4.325,4.3255,4.3261,4.3267,4.3272,4.3278,4.3284,4.3289,4.3295,4.33,4.3306,4.3312,4.3317,4.3323,4.3329,4.3334,4.334,4.3346,4.3351,4.3357,4.3363,4.3368,4.3374,4.3379,4.3385,4.3391,4.3396,4.3402,4.3408,4.3413,4.3419,4.3425,4.343,4.3436,4.3442,4.3447,4.3453,4.3458,4.3464,4.347,4.3475,4.3481,4.3487,4.3492,4.3498,4.3504,4.3509,4.3515,4.352,4.3526,4.3532,4.3537,4.3543,4.3549,4.3554,4.356,4.3566,4.3571,4.3577,4.3583,4.3588,4.3594,4.3599,4.3605,4.3611,4.3616,4.3622,4.3628,4.3633,4.3639,4.3645,4.365,4.3656,4.3662,4.3667,4.3673,4.3678,4.3684,4.369,4.3695,4.3701,4.3707,4.3712,4.3718,4.3724,4.3729,4.3735,4.374,4.3746,4.3752,4.3757,4.3763,4.3769,4.3774,4.378,4.3786,4.3791,4.3797,4.3802,4.3808,4.3814,4.3819,4.3825,4.3831,4.3836,4.3842,4.3848,4.3853,4.3859,4.3865,4.387,4.3876,4.3881,4.3887,4.3893,4.3898,4.3904,4.391,4.3915,4.3921,4.3927,4.3932,4.3938,4.3943,4.3949,4.3955,4.396,4.3966,4.3972,4.3977,4.3983,4.3989,4.3994,4.4,4.4005,4.4011,4.4017,4.4022,4.4028,4.4034,4.4039,4.4045,4.4051,4.4056,4.4062,4.4068,4.4073,4.4079,4.4084,4.409,4.4096,4.4101,4.4107,4.4113,4.4118,4.4124,4.413,4.4135,4.4141,4.4146,4.4152,4.4158,4.4163,4.4169,4.4175,4.418,4.4186,4.4192,4.4197,4.4203,4.4208,4.4214,4.422,4.4225,4.4231,4.4237,4.4242,4.4248,4.4254,4.4259,4.4265,4.427,4.4276,4.4282,4.4287,4.4293,4.4299,4.4304,4.431,4.4316,4.4321,4.4327,4.4332,4.4338,4.4344,4.4349,4.4355,4.4361,4.4366,4.4372,4.4378,4.4383,4.4389,4.4395,4.44,4.4406,4.4411,4.4417,4.4423,4.4428,4.4434,4.444,4.4445,4.4451,4.4457,4.4462,4.4468,4.4473,4.4479,4.4485,4.449,4.4496,4.4502,4.4507,4.4513,4.4519,4.4524,4.453,4.4535,4.4541,4.4547,4.4552,4.4558,4.4564,4.4569,4.4575,4.4581,4.4586,4.4592,4.4597,4.4603,4.4609,4.4614,4.462,4.4626,4.4631,4.4637,4.4643,4.4648,4.4654,4.4659,4.4665,4.4671,4.4676,4.4682,4.4688,4.4693,4.4699,4.4704,4.471,4.4716,4.4721,4.4727,4.4733,4.4738,4.4744,4.475,4.4755,4.4761,4.4766,4.4772,4.4778,4.4783,4.4789,4.4795,4.48,4.4806,4.4812,4.4817,4.4823,4.4828,4.4834,4.484,4.4845,4.4851,4.4857,4.4862,4.4868,4.4874,4.4879,4.4885,4.489,4.4896,4.4902,4.4907,4.4913,4.4919,4.4924,4.493,4.4936,4.4941,4.4947,4.4952,4.4958,4.4964,4.4969,4.4975,4.4981,4.4986,4.4992,4.4998,4.5003,4.5009,4.5014,4.502,4.5026,4.5031,4.5037,4.5043,4.5048,4.5054,4.5059,4.5065,4.5071,4.5076,4.5082,4.5088,4.5093,4.5099,4.5105,4.511,4.5116,4.5121,4.5127,4.5133,4.5138,4.5144,4.515,4.5155,4.5161,4.5167,4.5172,4.5178,4.5183,4.5189,4.5195,4.52,4.5206,4.5212,4.5217,4.5223,4.5229,4.5234,4.524,4.5245,4.5251,4.5257,4.5262,4.5268,4.5274,4.5279,4.5285,4.529,4.5296,4.5302,4.5307,4.5313,4.5319,4.5324,4.533,4.5336,4.5341,4.5347,4.5352,4.5358,4.5364,4.5369,4.5375,4.5381,4.5386,4.5392,4.5397,4.5403,4.5409,4.5414,4.542,4.5426,4.5431,4.5437,4.5443,4.5448,4.5454,4.5459,4.5465,4.5471,4.5476,4.5482,4.5488,4.5493,4.5499,4.5505,4.551,4.5516,4.5521,4.5527,4.5533,4.5538,4.5544,4.555,4.5555,4.5561,4.5566,4.5572,4.5578,4.5583,4.5589,4.5595,4.56,4.5606,4.5612,4.5617,4.5623,4.5628,4.5634,4.564,4.5645,4.5651,4.5657,4.5662,4.5668,4.5673,4.5679,4.5685,4.569,4.5696,4.5702,4.5707,4.5713,4.5719,4.5724,4.573,4.5735,4.5741,4.5747,4.5752,4.5758,4.5764,4.5769,4.5775,4.578,4.5786,4.5792,4.5797,4.5803,4.5809,4.5814,4.582,4.5826,4.5831,4.5837,4.5842,4.5848,4.5854,4.5859,4.5865,4.5871,4.5876,4.5882,4.5887,4.5893,4.5899,4.5904,4.591,4.5916,4.5921,4.5927,4.5933,4.5938,4.5944,4.5949,4.5955,4.5961,4.5966,4.5972,4.5978,4.5983,4.5989,4.5994,4.6,4.6006,4.6011,4.6017,4.6023,4.6028,4.6034,4.6039,4.6045,4.6051,4.6056,4.6062,4.6068,4.6073,4.6079,4.6085,4.609,4.6096,4.6101,4.6107,4.6113,4.6118,4.6124,4.613,4.6135,4.6141,4.6146,4.6152,4.6158,4.6163,4.6169,4.6175,4.618,4.6186,4.6191,4.6197,4.6203,4.6208,4.6214,4.622,4.6225,4.6231,4.6237,4.6242,4.6248,4.6253,4.6259,4.6265,4.627,4.6276,4.6282,4.6287,4.6293,4.6298,4.6304,4.631,4.6315,4.6321,4.6327,4.6332,4.6338,4.6343,4.6349,4.6355,4.636,4.6366,4.6372,4.6377,4.6383,4.6389,4.6394,4.64,4.6405,4.6411,4.6417,4.6422,4.6428,4.6434,4.6439,4.6445,4.645,4.6456,4.6462,4.6467,4.6473,4.6479,4.6484,4.649,4.6495,4.6501,4.6507,4.6512,4.6518,4.6524,4.6529,4.6535,4.654,4.6546,4.6552,4.6557,4.6563,4.6569,4.6574,4.658,4.6586,4.6591,4.6597,4.6602,4.6608,4.6614,4.6619,4.6625,4.6631,4.6636,4.6642,4.6647,4.6653,4.6659,4.6664,4.667,4.6676,4.6681,4.6687,4.6692,4.6698,4.6704,4.6709,4.6715,4.6721,4.6726,4.6732,4.6737,4.6743,4.6749,4.6754,4.676,4.6766,4.6771,4.6777,4.6782,4.6788,4.6794,4.6799,4.6805,4.6811,4.6816,4.6822,4.6828,4.6833,4.6839,4.6844,4.685,4.6856,4.6861,4.6867,4.6873,4.6878,4.6884,4.6889,4.6895,4.6901,4.6906,4.6912,4.6918,4.6923,4.6929,4.6934,4.694,4.6946,4.6951,4.6957,4.6963,4.6968,4.6974,4.6979,4.6985,4.6991,4.6996,4.7002,4.7008,4.7013,4.7019,4.7024,4.703,4.7036,4.7041,4.7047,4.7053,4.7058,4.7064,4.7069,4.7075,4.7081,4.7086,4.7092,4.7098,4.7103,4.7109,4.7114,4.712,4.7126,4.7131,4.7137,4.7143,4.7148,4.7154,4.7159,4.7165,4.7171,4.7176,4.7182,4.7188,4.7193,4.7199,4.7205,4.721,4.7216,4.7221,4.7227,4.7233,4.7238,4.7244,4.725,4.7255,4.7261,4.7266,4.7272,4.7278,4.7283,4.7289,4.7295,4.73,4.7306,4.7311,4.7317,4.7323,4.7328,4.7334,4.734,4.7345,4.7351,4.7356,4.7362,4.7368,4.7373,4.7379,4.7385,4.739,4.7396,4.7401,4.7407,4.7413,4.7418,4.7424,4.743,4.7435,4.7441,4.7446,4.7452,4.7458,4.7463,4.7469,4.7475,4.748,4.7486,4.7491,4.7497,4.7503,4.7508,4.7514,4.752,4.7525,4.7531,4.7536,4.7542,4.7548,4.7553,4.7559,4.7565,4.757,4.7576,4.7581,4.7587,4.7593,4.7598,4.7604,4.761,4.7615,4.7621,4.7626,4.7632,4.7638,4.7643,4.7649,4.7655,4.766,4.7666,4.7671,4.7677,4.7683,4.7688,4.7694,4.77,4.7705,4.7711,4.7716,4.7722,4.7728,4.7733,4.7739,4.7744,4.775,4.7756,4.7761,4.7767,4.7773,4.7778,4.7784,4.7789,4.7795,4.7801,4.7806,4.7812,4.7818,4.7823,4.7829,4.7834,4.784,4.7846,4.7851,4.7857,4.7863,4.7868,4.7874,4.7879,4.7885,4.7891,4.7896,4.7902,4.7908,4.7913,4.7919,4.7924,4.793,4.7936,4.7941,4.7947,4.7953,4.7958,4.7964,4.7969,4.7975,4.7981,4.7986,4.7992,4.7998,4.8003,4.8009,4.8014,4.802,4.8026,4.8031,4.8037,4.8043,4.8048,4.8054,4.8059,4.8065,4.8071,4.8076,4.8082,4.8088,4.8093,4.8099,4.8104,4.811,4.8116,4.8121,4.8127,4.8133,4.8138,4.8144,4.8149,4.8155,4.8161,4.8166,4.8172,4.8177,4.8183,4.8189,4.8194,4.82,4.8206,4.8211,4.8217,4.8222,4.8228,4.8234,4.8239,4.8245,4.8251,4.8256,4.8262,4.8267,4.8273,4.8279,4.8284,4.829,4.8296,4.8301,4.8307,4.8312,4.8318,4.8324,4.8329,4.8335,4.8341,4.8346,4.8352,4.8357,4.8363,4.8369,4.8374,4.838,4.8386,4.8391,4.8397,4.8402,4.8408,4.8414,4.8419,4.8425,4.843,4.8436,4.8442,4.8447,4.8453,4.8459,4.8464,4.847,4.8475,4.8481,4.8487,4.8492,4.8498,4.8504,4.8509,4.8515,4.852,4.8526,4.8532,4.8537,4.8543,4.8549,4.8554,4.856,4.8565,4.8571,4.8577,4.8582,4.8588,4.8594,4.8599,4.8605,4.861,4.8616,4.8622,4.8627,4.8633,4.8638,4.8644,4.865,4.8655,4.8661,4.8667,4.8672,4.8678,4.8683,4.8689,4.8695,4.87,4.8706,4.8712,4.8717,4.8723,4.8728,4.8734,4.874,4.8745,4.8751,4.8757,4.8762,4.8768,4.8773,4.8779,4.8785,4.879,4.8796,4.8801,4.8807,4.8813,4.8818,4.8824,4.883,4.8835,4.8841,4.8846,4.8852,4.8858,4.8863,4.8869,4.8875,4.888,4.8886,4.8891,4.8897,4.8903,4.8908,4.8914,4.892,4.8925,4.8931,4.8936,4.8942,4.8948,4.8953,4.8959,4.8964,4.897,4.8976,4.8981,4.8987,4.8993,4.8998,4.9004,4.9009,4.9015,4.9021,4.9026,4.9032,4.9038,4.9043,4.9049,4.9054,4.906,4.9066,4.9071,4.9077,4.9082,4.9088,4.9094,4.9099,4.9105,4.9111,4.9116,4.9122,4.9127,4.9133,4.9139,4.9144,4.915,4.9156,4.9161,4.9167,4.9172,4.9178,4.9184,4.9189,4.9195,4.92,4.9206,4.9212,4.9217,4.9223,4.9229,4.9234,4.924,4.9245,4.9251,4.9257,4.9262,4.9268,4.9274,4.9279,4.9285,4.929,4.9296,4.9302,4.9307,4.9313,4.9318,4.9324,4.933,4.9335,4.9341,4.9347,4.9352,4.9358,4.9363,4.9369,4.9375,4.938,4.9386,4.9392,4.9397,4.9403,4.9408,4.9414,4.942,4.9425,4.9431,4.9436,4.9442,4.9448,4.9453,4.9459,4.9465,4.947,4.9476,4.9481,4.9487,4.9493,4.9498,4.9504,4.951,4.9515,4.9521,4.9526,4.9532,4.9538,4.9543,4.9549,4.9554,4.956,4.9566,4.9571,4.9577,4.9583,4.9588,4.9594,4.9599,4.9605,4.9611,4.9616,4.9622,4.9627,4.9633,4.9639,4.9644,4.965,4.9656,4.9661,4.9667,4.9672,4.9678,4.9684,4.9689,4.9695,4.9701,4.9706,4.9712,4.9717,4.9723,4.9729,4.9734,4.974,4.9745,4.9751,4.9757,4.9762,4.9768,4.9774,4.9779,4.9785,4.979,4.9796,4.9802,4.9807,4.9813,4.9818,4.9824,4.983,4.9835,4.9841,4.9847,4.9852,4.9858,4.9863,4.9869,4.9875,4.988,4.9886,4.9892,4.9897,4.9903,4.9908,4.9914,4.992,4.9925,4.9931,4.9936,4.9942,4.9948,4.9953,4.9959,4.9965,4.997,4.9976,4.9981,4.9987,4.9993,4.9998,5.0004,5.0009,5.0015,5.0021,5.0026,5.0032,5.0038,5.0043,5.0049,5.0054,5.006,5.0066,5.0071,5.0077,5.0082,5.0088,5.0094,5.0099,5.0105,5.0111,5.0116,5.0122,5.0127,5.0133,5.0139,5.0144,5.015,5.0155,5.0161,5.0167,5.0172,5.0178,5.0184,5.0189,5.0195,5.02,5.0206,5.0212,5.0217,5.0223,5.0228,5.0234,5.024,5.0245,5.0251,5.0257,5.0262,5.0268,5.0273,5.0279,5.0285,5.029,5.0296,5.0301,5.0307,5.0313,5.0318,5.0324,5.033,5.0335,5.0341,5.0346,5.0352,5.0358,5.0363,5.0369,5.0375,5.038,5.0386,5.0391,5.0397,5.0403,5.0408,5.0414,5.0419,5.0425,5.0431,5.0436,5.0442,5.0448,5.0453,5.0459,5.0464,5.047,5.0476,5.0481,5.0487,5.0492,5.0498,5.0504,5.0509,5.0515,5.052,5.0526,5.0532,5.0537,5.0543,5.0549,5.0554,5.056,5.0565,5.0571,5.0577,5.0582,5.0588,5.0593,5.0599,5.0605,5.061,5.0616,5.0622,5.0627,5.0633,5.0638,5.0644,5.065,5.0655,5.0661,5.0666,5.0672,5.0678,5.0683,5.0689,5.0695,5.07,5.0706,5.0711,5.0717,5.0723,5.0728,5.0734,5.0739,5.0745,5.0751,5.0756,5.0762,5.0768,5.0773,5.0779,5.0784,5.079,5.0796,5.0801,5.0807,5.0812,5.0818,5.0824,5.0829,5.0835,5.0841,5.0846,5.0852,5.0857,5.0863,5.0869,5.0874,5.088,5.0885,5.0891,5.0897,5.0902,5.0908,5.0914,5.0919,5.0925,5.093,5.0936,5.0942,5.0947,5.0953,5.0958,5.0964,5.097,5.0975,5.0981,5.0986,5.0992,5.0998,5.1003,5.1009,5.1015,5.102,5.1026,5.1031,5.1037,5.1043,5.1048,5.1054,5.1059,5.1065,5.1071,5.1076,5.1082,5.1088,5.1093,5.1099,5.1104,5.111,5.1116,5.1121,5.1127,5.1132,5.1138,5.1144,5.1149,5.1155,5.1161,5.1166,5.1172,5.1177,5.1183,5.1189,5.1194,5.12,5.1205,5.1211,5.1217,5.1222,5.1228,5.1233,5.1239,5.1245,5.125,5.1256,5.1262,5.1267,5.1273,5.1278,5.1284,5.129,5.1295,5.1301,5.1306,5.1312,5.1318,5.1323,5.1329,5.1335,5.134,5.1346,5.1351,5.1357,5.1363,5.1368,5.1374,5.1379,5.1385,5.1391,5.1396,5.1402,5.1407,5.1413,5.1419,5.1424,5.143,5.1436,5.1441,5.1447,5.1452,5.1458,5.1464,5.1469,5.1475,5.148,5.1486,5.1492,5.1497,5.1503,5.1508,5.1514,5.152,5.1525,5.1531,5.1537,5.1542,5.1548,5.1553,5.1559,5.1565,5.157,5.1576,5.1581,5.1587,5.1593,5.1598,5.1604,5.161,5.1615,5.1621,5.1626,5.1632,5.1638,5.1643,5.1649,5.1654,5.166,5.1666,5.1671,5.1677,5.1682,5.1688,5.1694,5.1699,5.1705,5.1711,5.1716,5.1722,5.1727,5.1733,5.1739,5.1744,5.175,5.1755,5.1761,5.1767,5.1772,5.1778,5.1783,5.1789,5.1795,5.18,5.1806,5.1812,5.1817,5.1823,5.1828,5.1834,5.184,5.1845,5.1851,5.1856,5.1862,5.1868,5.1873,5.1879,5.1884,5.189,5.1896,5.1901,5.1907,5.1913,5.1918,5.1924,5.1929,5.1935,5.1941,5.1946,5.1952,5.1957,5.1963,5.1969,5.1974,5.198,5.1985,5.1991,5.1997,5.2002,5.2008,5.2014,5.2019,5.2025,5.203,5.2036,5.2042,5.2047,5.2053,5.2058,5.2064,5.207,5.2075,5.2081,5.2086,5.2092,5.2098,5.2103,5.2109,5.2115,5.212,5.2126,5.2131,5.2137,5.2143,5.2148,5.2154,5.2159,5.2165,5.2171,5.2176,5.2182,5.2187,5.2193,5.2199,5.2204,5.221,5.2216,5.2221,5.2227,5.2232,5.2238,5.2244,5.2249,5.2255,5.226,5.2266,5.2272,5.2277,5.2283,5.2288,5.2294,5.23,5.2305,5.2311,5.2316,5.2322,5.2328,5.2333,5.2339,5.2345,5.235,5.2356,5.2361,5.2367,5.2373,5.2378,5.2384,5.2389,5.2395,5.2401,5.2406,5.2412,5.2417,5.2423,5.2429,5.2434,5.244,5.2446,5.2451,5.2457,5.2462,5.2468,5.2474,5.2479,5.2485,5.249,5.2496,5.2502,5.2507,5.2513,5.2518,5.2524,5.253,5.2535,5.2541,5.2546,5.2552,5.2558,5.2563,5.2569,5.2575,5.258,5.2586,5.2591,5.2597,5.2603,5.2608,5.2614,5.2619,5.2625,5.2631,5.2636,5.2642,5.2647,5.2653,5.2659,5.2664,5.267,5.2675,5.2681,5.2687,5.2692,5.2698,5.2704,5.2709,5.2715,5.272,5.2726,5.2732,5.2737,5.2743,5.2748,5.2754,5.276,5.2765,5.2771,5.2776,5.2782,5.2788,5.2793,5.2799,5.2804,5.281,5.2816,5.2821,5.2827,5.2833,5.2838,5.2844,5.2849,5.2855,5.2861,5.2866,5.2872,5.2877,5.2883,5.2889,5.2894,5.29,5.2905,5.2911,5.2917,5.2922,5.2928,5.2933,5.2939,5.2945,5.295,5.2956,5.2962,5.2967,5.2973,5.2978,5.2984,5.299,5.2995,5.3001,5.3006,5.3012,5.3018,5.3023,5.3029,5.3034,5.304,5.3046,5.3051,5.3057,5.3062,5.3068,5.3074,5.3079,5.3085,5.3091,5.3096,5.3102,5.3107,5.3113,5.3119,5.3124,5.313,5.3135,5.3141,5.3147,5.3152,5.3158,5.3163,5.3169,5.3175,5.318,5.3186,5.3191,5.3197,5.3203,5.3208,5.3214,5.3219,5.3225,5.3231,5.3236,5.3242,5.3248,5.3253,5.3259,5.3264,5.327,5.3276,5.3281,5.3287,5.3292,5.3298,5.3304,5.3309,5.3315,5.332,5.3326,5.3332,5.3337,5.3343,5.3348,5.3354,5.336,5.3365,5.3371,5.3376,5.3382,5.3388,5.3393,5.3399,5.3405,5.341,5.3416,5.3421,5.3427,5.3433,5.3438,5.3444,5.3449,5.3455,5.3461,5.3466,5.3472,5.3477,5.3483,5.3489,5.3494,5.35,5.3505,5.3511,5.3517,5.3522,5.3528,5.3533,5.3539,5.3545,5.355,5.3556,5.3562,5.3567,5.3573,5.3578,5.3584,5.359,5.3595,5.3601,5.3606,5.3612,5.3618,5.3623,5.3629,5.3634,5.364,5.3646,5.3651,5.3657,5.3662,5.3668,5.3674,5.3679,5.3685,5.369,5.3696,5.3702,5.3707,5.3713,5.3718,5.3724,5.373,5.3735,5.3741,5.3747,5.3752,5.3758,5.3763,5.3769,5.3775,5.378,5.3786,5.3791,5.3797,5.3803,5.3808,5.3814,5.3819,5.3825,5.3831,5.3836,5.3842,5.3847,5.3853,5.3859,5.3864,5.387,5.3875,5.3881,5.3887,5.3892,5.3898,5.3903,5.3909,5.3915,5.392,5.3926,5.3932,5.3937,5.3943,5.3948,5.3954,5.396,5.3965,5.3971,5.3976,5.3982,5.3988,5.3993,5.3999,5.4004,5.401,5.4016,5.4021,5.4027,5.4032,5.4038,5.4044,5.4049,5.4055,5.406,5.4066,5.4072,5.4077,5.4083,5.4088,5.4094,5.41,5.4105,5.4111,5.4116,5.4122,5.4128,5.4133,5.4139,5.4145,5.415,5.4156,5.4161,5.4167,5.4173,5.4178,5.4184,5.4189,5.4195,5.4201,5.4206,5.4212,5.4217,5.4223,5.4229,5.4234,5.424,5.4245,5.4251,5.4257,5.4262,5.4268,5.4273,5.4279,5.4285,5.429,5.4296,5.4301,5.4307,5.4313,5.4318,5.4324,5.4329,5.4335,5.4341,5.4346,5.4352,5.4358,5.4363,5.4369,5.4374,5.438,5.4386,5.4391,5.4397,5.4402,5.4408,5.4414,5.4419,5.4425,5.443,5.4436,5.4442,5.4447,5.4453,5.4458,5.4464,5.447,5.4475,5.4481,5.4486,5.4492,5.4498,5.4503,5.4509,5.4514,5.452,5.4526,5.4531,5.4537,5.4542,5.4548,5.4554,5.4559,5.4565,5.457,5.4576,5.4582,5.4587,5.4593,5.4598,5.4604,5.461,5.4615,5.4621,5.4627,5.4632,5.4638,5.4643,5.4649,5.4655,5.466,5.4666,5.4671,5.4677,5.4683,5.4688,5.4694,5.4699,5.4705,5.4711,5.4716,5.4722,5.4727,5.4733,5.4739,5.4744,5.475,5.4755,5.4761,5.4767,5.4772,5.4778,5.4783,5.4789,5.4795,5.48,5.4806,5.4811,5.4817,5.4823,5.4828,5.4834,5.4839,5.4845,5.4851,5.4856,5.4862,5.4867,5.4873,5.4879,5.4884,5.489,5.4895,5.4901,5.4907,5.4912,5.4918,5.4923,5.4929,5.4935,5.494,5.4946,5.4952,5.4957,5.4963,5.4968,5.4974,5.498,5.4985,5.4991,5.4996,5.5002,5.5008,5.5013,5.5019,5.5024,5.503,5.5036,5.5041,5.5047,5.5052,5.5058,5.5064,5.5069,5.5075,5.508,5.5086,5.5092,5.5097,5.5103,5.5108,5.5114,5.512,5.5125,5.5131,5.5136,5.5142,5.5148,5.5153,5.5159,5.5164,5.517,5.5176,5.5181,5.5187,5.5192,5.5198,5.5204,5.5209,5.5215,5.522,5.5226,5.5232,5.5237,5.5243,5.5248,5.5254,5.526,5.5265,5.5271,5.5276,5.5282,5.5288,5.5293,5.5299,5.5304,5.531,5.5316,5.5321,5.5327,5.5332,5.5338,5.5344,5.5349,5.5355,5.5361,5.5366,5.5372,5.5377,5.5383,5.5389,5.5394,5.54,5.5405,5.5411,5.5417,5.5422,5.5428,5.5433,5.5439,5.5445,5.545,5.5456,5.5461,5.5467,5.5473,5.5478,5.5484,5.5489,5.5495,5.5501,5.5506,5.5512,5.5517,5.5523,5.5529,5.5534,5.554,5.5545,5.5551,5.5557,5.5562,5.5568,5.5573,5.5579,5.5585,5.559,5.5596,5.5601,5.5607,5.5613,5.5618,5.5624,5.5629,5.5635,5.5641,5.5646,5.5652,5.5657,5.5663,5.5669,5.5674,5.568,5.5685,5.5691,5.5697,5.5702,5.5708,5.5713,5.5719,5.5725,5.573,5.5736,5.5741,5.5747,5.5753,5.5758,5.5764,5.5769,5.5775,5.5781,5.5786,5.5792,5.5797,5.5803,5.5809,5.5814,5.582,5.5825,5.5831,5.5837,5.5842,5.5848,5.5853,5.5859,5.5865,5.587,5.5876,5.5881,5.5887,5.5893,5.5898,5.5904,5.5909,5.5915,5.5921,5.5926,5.5932,5.5937,5.5943,5.5949,5.5954,5.596,5.5965,5.5971,5.5977,5.5982,5.5988,5.5993,5.5999,5.6005,5.601,5.6016,5.6021,5.6027,5.6033,5.6038,5.6044,5.6049,5.6055,5.6061,5.6066,5.6072,5.6077,5.6083,5.6089,5.6094,5.61,5.6105,5.6111,5.6117,5.6122,5.6128,5.6133,5.6139,5.6145,5.615,5.6156,5.6161,5.6167,5.6173,5.6178,5.6184,5.6189,5.6195,5.6201,5.6206,5.6212,5.6217,5.6223,5.6229,5.6234,5.624,5.6245,5.6251,5.6257,5.6262,5.6268,5.6273,5.6279,5.6285,5.629,5.6296,5.6301,5.6307,5.6313,5.6318,5.6324,5.6329,5.6335,5.6341,5.6346,5.6352,5.6357,5.6363,5.6369,5.6374,5.638,5.6385,5.6391,5.6397,5.6402,5.6408,5.6413,5.6419,5.6425,5.643,5.6436,5.6441,5.6447,5.6453,5.6458,5.6464,5.6469,5.6475,5.6481,5.6486,5.6492,5.6497,5.6503,5.6509,5.6514,5.652,5.6525,5.6531,5.6537,5.6542,5.6548,5.6553,5.6559,5.6565,5.657,5.6576,5.6581,5.6587,5.6593,5.6598,5.6604,5.6609,5.6615,5.6621,5.6626,5.6632,5.6637,5.6643,5.6649,5.6654,5.666,5.6665,5.6671,5.6677,5.6682,5.6688,5.6693,5.6699,5.6705,5.671,5.6716,5.6721,5.6727,5.6733,5.6738,5.6744,5.6749,5.6755,5.6761,5.6766,5.6772,5.6777,5.6783,5.6789,5.6794,5.68,5.6805,5.6811,5.6817,5.6822,5.6828,5.6833,5.6839,5.6845,5.685,5.6856,5.6861,5.6867,5.6873,5.6878,5.6884,5.6889,5.6895,5.6901,5.6906,5.6912,5.6917,5.6923,5.6929,5.6934,5.694,5.6945,5.6951,5.6957,5.6962,5.6968,5.6973,5.6979,5.6985,5.699,5.6996,5.7001,5.7007,5.7013,5.7018,5.7024,5.7029,5.7035,5.7041,5.7046,5.7052,5.7057,5.7063,5.7069,5.7074,5.708,5.7085,5.7091,5.7097,5.7102,5.7108,5.7113,5.7119,5.7125,5.713,5.7136,5.7141,5.7147,5.7153,5.7158,5.7164,5.7169,5.7175,5.7181,5.7186,5.7192,5.7197,5.7203,5.7209,5.7214,5.722,5.7225,5.7231,5.7236,5.7242,5.7248,5.7253,5.7259,5.7264,5.727,5.7276,5.7281,5.7287,5.7292,5.7298,5.7304,5.7309,5.7315,5.732,5.7326,5.7332,5.7337,5.7343,5.7348,5.7354,5.736,5.7365,5.7371,5.7376,5.7382,5.7388,5.7393,5.7399,5.7404,5.741,5.7416,5.7421,5.7427,5.7432,5.7438,5.7444,5.7449,5.7455,5.746,5.7466,5.7472,5.7477,5.7483,5.7488,5.7494,5.75,5.7505,5.7511,5.7516,5.7522,5.7528,5.7533,5.7539,5.7544,5.755,5.7556,5.7561,5.7567,5.7572,5.7578,5.7584,5.7589,5.7595,5.76,5.7606,5.7612,5.7617,5.7623,5.7628,5.7634,5.764,5.7645,5.7651,5.7656,5.7662,5.7667,5.7673,5.7679,5.7684,5.769,5.7695,5.7701,5.7707,5.7712,5.7718,5.7723,5.7729,5.7735,5.774,5.7746,5.7751,5.7757,5.7763,5.7768,5.7774,5.7779,5.7785,5.7791,5.7796,5.7802,5.7807,5.7813,5.7819,5.7824,5.783,5.7835,5.7841,5.7847,5.7852,5.7858,5.7863,5.7869,5.7875,5.788,5.7886,5.7891,5.7897,5.7903,5.7908,5.7914,5.7919,5.7925,5.7931,5.7936,5.7942,5.7947,5.7953,5.7959,5.7964,5.797,5.7975,5.7981,5.7986,5.7992,5.7998,5.8003,5.8009,5.8014,5.802,5.8026,5.8031,5.8037,5.8042,5.8048,5.8054,5.8059,5.8065,5.807,5.8076,5.8082,5.8087,5.8093,5.8098,5.8104,5.811,5.8115,5.8121,5.8126,5.8132,5.8138,5.8143,5.8149,5.8154,5.816,5.8166,5.8171,5.8177,5.8182,5.8188,5.8194,5.8199,5.8205,5.821,5.8216,5.8222,5.8227,5.8233,5.8238,5.8244,5.825,5.8255,5.8261,5.8266,5.8272,5.8277,5.8283,5.8289,5.8294,5.83,5.8305,5.8311,5.8317,5.8322,5.8328,5.8333,5.8339,5.8345,5.835,5.8356,5.8361,5.8367,5.8373,5.8378,5.8384,5.8389,5.8395,5.8401,5.8406,5.8412,5.8417,5.8423,5.8429,5.8434,5.844,5.8445,5.8451,5.8457,5.8462,5.8468,5.8473,5.8479,5.8485,5.849,5.8496,5.8501,5.8507,5.8512,5.8518,5.8524,5.8529,5.8535,5.854,5.8546,5.8552,5.8557,5.8563,5.8568,5.8574,5.858,5.8585,5.8591,5.8596,5.8602,5.8608,5.8613,5.8619,5.8624,5.863,5.8636,5.8641,5.8647,5.8652,5.8658,5.8664,5.8669,5.8675,5.868,5.8686,5.8692,5.8697,5.8703,5.8708,5.8714,5.872,5.8725,5.8731,5.8736,5.8742,5.8747,5.8753,5.8759,5.8764,5.877,5.8775,5.8781,5.8787,5.8792,5.8798,5.8803,5.8809,5.8815,5.882,5.8826,5.8831,5.8837,5.8843,5.8848,5.8854,5.8859,5.8865,5.8871,5.8876,5.8882,5.8887,5.8893,5.8899,5.8904,5.891,5.8915,5.8921,5.8927,5.8932,5.8938,5.8943,5.8949,5.8954,5.896,5.8966,5.8971,5.8977,5.8982,5.8988,5.8994,5.8999,5.9005,5.901,5.9016,5.9022,5.9027,5.9033,5.9038,5.9044,5.905,5.9055,5.9061,5.9066,5.9072,5.9078,5.9083,5.9089,5.9094,5.91,5.9106,5.9111,5.9117,5.9122,5.9128,5.9133,5.9139,5.9145,5.915,5.9156,5.9161,5.9167,5.9173,5.9178,5.9184,5.9189,5.9195,5.9201,5.9206,5.9212,5.9217,5.9223,5.9229,5.9234,5.924,5.9245,5.9251,5.9257,5.9262,5.9268,5.9273,5.9279,5.9285,5.929,5.9296,5.9301,5.9307,5.9312,5.9318,5.9324,5.9329,5.9335,5.934,5.9346,5.9352,5.9357,5.9363,5.9368,5.9374,5.938,5.9385,5.9391,5.9396,5.9402,5.9408,5.9413,5.9419,5.9424,5.943,5.9436,5.9441,5.9447,5.9452,5.9458,5.9464,5.9469,5.9475,5.948,5.9486,5.9491,5.9497,5.9503,5.9508,5.9514,5.9519,5.9525,5.9531,5.9536,5.9542,5.9547,5.9553,5.9559,5.9564,5.957,5.9575,5.9581,5.9587,5.9592,5.9598,5.9603,5.9609,5.9615,5.962,5.9626,5.9631,5.9637,5.9642,5.9648,5.9654,5.9659,5.9665,5.967,5.9676,5.9682,5.9687,5.9693,5.9698,5.9704,5.971,5.9715,5.9721,5.9726,5.9732,5.9738,5.9743,5.9749,5.9754,5.976,5.9766,5.9771,5.9777,5.9782,5.9788,5.9793,5.9799,5.9805,5.981,5.9816,5.9821,5.9827,5.9833,5.9838,5.9844,5.9849,5.9855,5.9861,5.9866,5.9872,5.9877,5.9883,5.9889,5.9894,5.99,5.9905,5.9911,5.9917,5.9922,5.9928,5.9933,5.9939,5.9944,5.995,5.9956,5.9961,5.9967,5.9972,5.9978,5.9984,5.9989,5.9995,6,6.0006,6.0012,6.0017,6.0023,6.0028,6.0034,6.004,6.0045,6.0051,6.0056,6.0062,6.0068,6.0073,6.0079,6.0084,6.009,6.0095,6.0101,6.0107,6.0112,6.0118,6.0123,6.0129,6.0135,6.014,6.0146,6.0151,6.0157,6.0163,6.0168,6.0174,6.0179,6.0185,6.0191,6.0196,6.0202,6.0207,6.0213,6.0218,6.0224,6.023,6.0235,6.0241,6.0246,6.0252,6.0258,6.0263,6.0269,6.0274,6.028,6.0286,6.0291,6.0297,6.0302,6.0308,6.0314,6.0319,6.0325,6.033,6.0336,6.0342,6.0347,6.0353,6.0358,6.0364,6.0369,6.0375,6.0381,6.0386,6.0392,6.0397,6.0403,6.0409,6.0414,6.042,6.0425,6.0431,6.0437,6.0442,6.0448,6.0453,6.0459,6.0465,6.047,6.0476,6.0481,6.0487,6.0492,6.0498,6.0504,6.0509,6.0515,6.052,6.0526,6.0532,6.0537,6.0543,6.0548,6.0554,6.056,6.0565,6.0571,6.0576,6.0582,6.0588,6.0593,6.0599,6.0604,6.061,6.0615,6.0621,6.0627,6.0632,6.0638,6.0643,6.0649,6.0655,6.066,6.0666,6.0671,6.0677,6.0683,6.0688,6.0694,6.0699,6.0705,6.0711,6.0716,6.0722,6.0727,6.0733,6.0738,6.0744,6.075,6.0755,6.0761,6.0766,6.0772,6.0778,6.0783,6.0789,6.0794,6.08,6.0806,6.0811,6.0817,6.0822,6.0828,6.0834,6.0839,6.0845,6.085,6.0856,6.0861,6.0867,6.0873,6.0878,6.0884,6.0889,6.0895,6.0901,6.0906,6.0912,6.0917,6.0923,6.0929,6.0934,6.094,6.0945,6.0951,6.0957,6.0962,6.0968,6.0973,6.0979,6.0984,6.099,6.0996,6.1001,6.1007,6.1012,6.1018,6.1024,6.1029,6.1035,6.104,6.1046,6.1052,6.1057,6.1063,6.1068,6.1074,6.108,6.1085,6.1091,6.1096,6.1102,6.1107,6.1113,6.1119,6.1124,6.113,6.1135,6.1141,6.1147,6.1152,6.1158,6.1163,6.1169,6.1175,6.118,6.1186,6.1191,6.1197,6.1202,6.1208,6.1214,6.1219,6.1225,6.123,6.1236,6.1242,6.1247,6.1253,6.1258,6.1264,6.127,6.1275,6.1281,6.1286,6.1292,6.1298,6.1303,6.1309,6.1314,6.132,6.1325,6.1331,6.1337,6.1342,6.1348,6.1353,6.1359,6.1365,6.137,6.1376,6.1381,6.1387,6.1393,6.1398,6.1404,6.1409,6.1415,6.142,6.1426,6.1432,6.1437,6.1443,6.1448,6.1454,6.146,6.1465,6.1471,6.1476,6.1482,6.1488,6.1493,6.1499,6.1504,6.151,6.1516,6.1521,6.1527,6.1532,6.1538,6.1543,6.1549,6.1555,6.156,6.1566,6.1571,6.1577,6.1583,6.1588,6.1594,6.1599,6.1605,6.1611,6.1616,6.1622,6.1627,6.1633,6.1638,6.1644,6.165,6.1655,6.1661,6.1666,6.1672,6.1678,6.1683,6.1689,6.1694,6.17,6.1706,6.1711,6.1717,6.1722,6.1728,6.1733,6.1739,6.1745,6.175,6.1756,6.1761,6.1767,6.1773,6.1778,6.1784,6.1789,6.1795,6.1801,6.1806,6.1812,6.1817,6.1823,6.1828,6.1834,6.184,6.1845,6.1851,6.1856,6.1862,6.1868,6.1873,6.1879,6.1884,6.189,6.1896,6.1901,6.1907,6.1912,6.1918,6.1924,6.1929,6.1935,6.194,6.1946,6.1951,6.1957,6.1963,6.1968,6.1974,6.1979,6.1985,6.1991,6.1996,6.2002,6.2007,6.2013,6.2019,6.2024,6.203,6.2035,6.2041,6.2046,6.2052,6.2058,6.2063,6.2069,6.2074,6.208,6.2086,6.2091,6.2097,6.2102,6.2108,6.2114,6.2119,6.2125,6.213,6.2136,6.2141,6.2147,6.2153,6.2158,6.2164,6.2169,6.2175,6.2181,6.2186,6.2192,6.2197,6.2203,6.2209,6.2214,6.222,6.2225,6.2231,6.2236,6.2242,6.2248,6.2253,6.2259,6.2264,6.227,6.2276,6.2281,6.2287,6.2292,6.2298,6.2304,6.2309,6.2315,6.232,6.2326,6.2331,6.2337,6.2343,6.2348,6.2354,6.2359,6.2365,6.2371,6.2376,6.2382,6.2387,6.2393,6.2398,6.2404,6.241,6.2415,6.2421,6.2426,6.2432,6.2438,6.2443,6.2449,6.2454,6.246,6.2466,6.2471,6.2477,6.2482,6.2488,6.2493,6.2499,6.2505,6.251,6.2516,6.2521,6.2527,6.2533,6.2538,6.2544,6.2549,6.2555,6.2561,6.2566,6.2572,6.2577,6.2583,6.2588,6.2594,6.26,6.2605,6.2611,6.2616,6.2622,6.2628,6.2633,6.2639,6.2644,6.265,6.2656,6.2661,6.2667,6.2672,6.2678,6.2683,6.2689,6.2695,6.27,6.2706,6.2711,6.2717,6.2723,6.2728,6.2734,6.2739,6.2745,6.2751,6.2756,6.2762,6.2767,6.2773,6.2778,6.2784,6.279,6.2795,6.2801,6.2806,6.2812,6.2818,6.2823,6.2829,6.2834,6.284,6.2845,6.2851,6.2857,6.2862,6.2868,6.2873,6.2879,6.2885,6.289,6.2896,6.2901,6.2907,6.2913,6.2918,6.2924,6.2929,6.2935,6.294,6.2946,6.2952,6.2957,6.2963,6.2968,6.2974,6.298,6.2985,6.2991,6.2996,6.3002,6.3008,6.3013,6.3019,6.3024,6.303,6.3035,6.3041,6.3047,6.3052,6.3058,6.3063,6.3069,6.3075,6.308,6.3086,6.3091,6.3097,6.3102,6.3108,6.3114,6.3119,6.3125,6.313,6.3136,6.3142,6.3147,6.3153,6.3158,6.3164,6.317,6.3175,6.3181,6.3186,6.3192,6.3197,6.3203,6.3209,6.3214,6.322,6.3225,6.3231,6.3237,6.3242,6.3248,6.3253,6.3259,6.3264,6.327,6.3276,6.3281,6.3287,6.3292,6.3298,6.3304,6.3309,6.3315,6.332,6.3326,6.3332,6.3337,6.3343,6.3348,6.3354,6.3359,6.3365,6.3371,6.3376,6.3382,6.3387,6.3393,6.3399,6.3404,6.341,6.3415,6.3421,6.3426,6.3432,6.3438,6.3443,6.3449,6.3454,6.346,6.3466,6.3471,6.3477,6.3482,6.3488,6.3494,6.3499,6.3505,6.351,6.3516,6.3521,6.3527,6.3533,6.3538,6.3544,6.3549,6.3555,6.3561,6.3566,6.3572,6.3577,6.3583,6.3588,6.3594,6.36,6.3605,6.3611,6.3616,6.3622,6.3628,6.3633,6.3639,6.3644,6.365,6.3655,6.3661,6.3667,6.3672,6.3678,6.3683,6.3689,6.3695,6.37,6.3706,6.3711,6.3717,6.3723,6.3728,6.3734,6.3739,6.3745,6.375,6.3756,6.3762,6.3767,6.3773,6.3778,6.3784,6.379,6.3795,6.3801,6.3806,6.3812,6.3817,6.3823,6.3829,6.3834,6.384,6.3845,6.3851,6.3857,6.3862,6.3868,6.3873,6.3879,6.3885,6.389,6.3896,6.3901,6.3907,6.3912,6.3918,6.3924,6.3929,6.3935,6.394,6.3946,6.3952,6.3957,6.3963,6.3968,6.3974,6.3979,6.3985,6.3991,6.3996,6.4002,6.4007,6.4013,6.4019,6.4024,6.403,6.4035,6.4041,6.4046,6.4052,6.4058,6.4063,6.4069,6.4074,6.408,6.4086,6.4091,6.4097,6.4102,6.4108,6.4113,6.4119,6.4125,6.413,6.4136,6.4141,6.4147,6.4153,6.4158,6.4164,6.4169,6.4175,6.4181,6.4186,6.4192,6.4197,6.4203,6.4208,6.4214,6.422,6.4225,6.4231,6.4236,6.4242,6.4248,6.4253,6.4259,6.4264,6.427,6.4275,6.4281,6.4287,6.4292,6.4298,6.4303,6.4309,6.4315,6.432,6.4326,6.4331,6.4337,6.4342,6.4348,6.4354,6.4359,6.4365,6.437,6.4376,6.4382,6.4387,6.4393,6.4398,6.4404,6.4409,6.4415,6.4421,6.4426,6.4432,6.4437,6.4443,6.4449,6.4454,6.446,6.4465,6.4471,6.4476,6.4482,6.4488,6.4493,6.4499,6.4504,6.451,6.4516,6.4521,6.4527,6.4532,6.4538,6.4543,6.4549,6.4555,6.456,6.4566,6.4571,6.4577,6.4583,6.4588,6.4594,6.4599,6.4605,6.4611,6.4616,6.4622,6.4627,6.4633,6.4638,6.4644,6.465,6.4655,6.4661,6.4666,6.4672,6.4678,6.4683,6.4689,6.4694,6.47,6.4705,6.4711,6.4717,6.4722,6.4728,6.4733,6.4739,6.4745,6.475,6.4756,6.4761,6.4767,6.4772,6.4778,6.4784,6.4789,6.4795,6.48,6.4806,6.4812,6.4817,6.4823,6.4828,6.4834,6.4839,6.4845,6.4851,6.4856,6.4862,6.4867,6.4873,6.4879,6.4884,6.489,6.4895,6.4901,6.4906,6.4912,6.4918,6.4923,6.4929,6.4934,6.494,6.4946,6.4951,6.4957,6.4962,6.4968,6.4973,6.4979,6.4985,6.499,6.4996,6.5001,6.5007,6.5013,6.5018,6.5024,6.5029,6.5035,6.504,6.5046,6.5052,6.5057,6.5063,6.5068,6.5074,6.508,6.5085,6.5091,6.5096,6.5102,6.5107,6.5113,6.5119,6.5124,6.513,6.5135,6.5141,6.5147,6.5152,6.5158,6.5163,6.5169,6.5174,6.518,6.5186,6.5191,6.5197,6.5202,6.5208,6.5214,6.5219,6.5225,6.523,6.5236,6.5241,6.5247,6.5253,6.5258,6.5264,6.5269,6.5275,6.5281,6.5286,6.5292,6.5297,6.5303,6.5308,6.5314,6.532,6.5325,6.5331,6.5336,6.5342,6.5348,6.5353,6.5359,6.5364,6.537,6.5375,6.5381,6.5387,6.5392,6.5398,6.5403
-	}};
-
-	const std::array<float,10001> diodeDropDx = {{
-		0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022156,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022155,0.0022154,0.0022154,0.0022154,0.0022154,0.0022154,0.0022154,0.0022154,0.0022153,0.0022153,0.0022153,0.0022153,0.0022153,0.0022152,0.0022152,0.0022152,0.0022152,0.0022152,0.0022151,0.0022151,0.0022151,0.0022151,0.002215,0.002215,0.002215,0.002215,0.0022149,0.0022149,0.0022149,0.0022148,0.0022148,0.0022148,0.0022147,0.0022147,0.0022147,0.0022146,0.0022146,0.0022146,0.0022145,0.0022145,0.0022144,0.0022144,0.0022144,0.0022143,0.0022143,0.0022142,0.0022142,0.0022141,0.0022141,0.002214,0.002214,0.0022139,0.0022139,0.0022138,0.0022138,0.0022137,0.0022136,0.0022136,0.0022135,0.0022134,0.0022134,0.0022133,0.0022132,0.0022132,0.0022131,0.002213,0.002213,0.0022129,0.0022128,0.0022127,0.0022126,0.0022126,0.0022125,0.0022124,0.0022123,0.0022122,0.0022121,0.002212,0.0022119,0.0022118,0.0022117,0.0022116,0.0022115,0.0022114,0.0022113,0.0022112,0.0022111,0.0022109,0.0022108,0.0022107,0.0022106,0.0022104,0.0022103,0.0022102,0.00221,0.0022099,0.0022098,0.0022096,0.0022095,0.0022093,0.0022092,0.002209,0.0022088,0.0022087,0.0022085,0.0022083,0.0022082,0.002208,0.0022078,0.0022076,0.0022074,0.0022072,0.002207,0.0022068,0.0022066,0.0022064,0.0022062,0.0022059,0.0022057,0.0022055,0.0022052,0.002205,0.0022048,0.0022045,0.0022042,0.002204,0.0022037,0.0022034,0.0022032,0.0022029,0.0022026,0.0022023,0.002202,0.0022017,0.0022013,0.002201,0.0022007,0.0022004,0.0022,0.0021997,0.0021993,0.0021989,0.0021986,0.0021982,0.0021978,0.0021974,0.002197,0.0021966,0.0021961,0.0021957,0.0021953,0.0021948,0.0021944,0.0021939,0.0021934,0.0021929,0.0021924,0.0021919,0.0021914,0.0021909,0.0021903,0.0021898,0.0021892,0.0021887,0.0021881,0.0021875,0.0021869,0.0021863,0.0021856,0.002185,0.0021843,0.0021837,0.002183,0.0021823,0.0021816,0.0021808,0.0021801,0.0021793,0.0021786,0.0021778,0.002177,0.0021762,0.0021753,0.0021745,0.0021736,0.0021727,0.0021718,0.0021709,0.00217,0.002169,0.0021681,0.0021671,0.0021661,0.0021651,0.002164,0.0021629,0.0021619,0.0021608,0.0021596,0.0021585,0.0021573,0.0021561,0.0021549,0.0021537,0.0021524,0.0021511,0.0021498,0.0021485,0.0021472,0.0021458,0.0021444,0.002143,0.0021415,0.00214,0.0021385,0.002137,0.0021354,0.0021338,0.0021322,0.0021306,0.0021289,0.0021272,0.0021255,0.0021238,0.002122,0.0021202,0.0021183,0.0021164,0.0021145,0.0021126,0.0021106,0.0021086,0.0021066,0.0021045,0.0021024,0.0021003,0.0020981,0.0020959,0.0020937,0.0020914,0.0020891,0.0020867,0.0020844,0.0020819,0.0020795,0.002077,0.0020745,0.0020719,0.0020693,0.0020667,0.002064,0.0020613,0.0020586,0.0020558,0.0020529,0.0020501,0.0020472,0.0020442,0.0020413,0.0020382,0.0020352,0.0020321,0.0020289,0.0020258,0.0020225,0.0020193,0.002016,0.0020127,0.0020093,0.0020059,0.0020024,0.0019989,0.0019954,0.0019918,0.0019882,0.0019845,0.0019808,0.0019771,0.0019733,0.0019695,0.0019657,0.0019618,0.0019578,0.0019539,0.0019499,0.0019458,0.0019418,0.0019376,0.0019335,0.0019293,0.0019251,0.0019208,0.0019165,0.0019122,0.0019078,0.0019034,0.001899,0.0018945,0.0018901,0.0018855,0.001881,0.0018764,0.0018718,0.0018671,0.0018624,0.0018577,0.001853,0.0018482,0.0018434,0.0018386,0.0018338,0.0018289,0.001824,0.0018191,0.0018142,0.0018092,0.0018042,0.0017992,0.0017942,0.0017892,0.0017841,0.001779,0.0017739,0.0017688,0.0017637,0.0017586,0.0017534,0.0017482,0.0017431,0.0017379,0.0017327,0.0017275,0.0017222,0.001717,0.0017118,0.0017065,0.0017013,0.001696,0.0016907,0.0016855,0.0016802,0.0016749,0.0016697,0.0016644,0.0016591,0.0016538,0.0016486,0.0016433,0.001638,0.0016328,0.0016275,0.0016222,0.001617,0.0016117,0.0016065,0.0016012,0.001596,0.0015908,0.0015856,0.0015804,0.0015752,0.00157,0.0015648,0.0015597,0.0015545,0.0015494,0.0015443,0.0015392,0.0015341,0.001529,0.001524,0.0015189,0.0015139,0.0015089,0.0015039,0.0014989,0.0014939,0.001489,0.0014841,0.0014791,0.0014743,0.0014694,0.0014645,0.0014597,0.0014549,0.0014501,0.0014453,0.0014406,0.0014359,0.0014312,0.0014265,0.0014218,0.0014172,0.0014126,0.001408,0.0014034,0.0013989,0.0013944,0.0013899,0.0013854,0.0013809,0.0013765,0.0013721,0.0013677,0.0013634,0.001359,0.0013547,0.0013505,0.0013462,0.001342,0.0013378,0.0013336,0.0013294,0.0013253,0.0013212,0.0013171,0.001313,0.001309,0.001305,0.001301,0.001297,0.0012931,0.0012892,0.0012853,0.0012814,0.0012776,0.0012738,0.00127,0.0012662,0.0012625,0.0012588,0.0012551,0.0012514,0.0012478,0.0012442,0.0012406,0.001237,0.0012335,0.00123,0.0012265,0.001223,0.0012195,0.0012161,0.0012127,0.0012093,0.001206,0.0012026,0.0011993,0.001196,0.0011928,0.0011895,0.0011863,0.0011831,0.0011799,0.0011768,0.0011736,0.0011705,0.0011675,0.0011644,0.0011613,0.0011583,0.0011553,0.0011523,0.0011494,0.0011464,0.0011435,0.0011406,0.0011377,0.0011349,0.001132,0.0011292,0.0011264,0.0011237,0.0011209,0.0011182,0.0011154,0.0011127,0.0011101,0.0011074,0.0011048,0.0011021,0.0010995,0.001097,0.0010944,0.0010918,0.0010893,0.0010868,0.0010843,0.0010818,0.0010794,0.0010769,0.0010745,0.0010721,0.0010697,0.0010673,0.001065,0.0010626,0.0010603,0.001058,0.0010557,0.0010534,0.0010512,0.0010489,0.0010467,0.0010445,0.0010423,0.0010401,0.0010379,0.0010358,0.0010336,0.0010315,0.0010294,0.0010273,0.0010252,0.0010232,0.0010211,0.0010191,0.0010171,0.0010151,0.0010131,0.0010111,0.0010091,0.0010072,0.0010052,0.0010033,0.0010014,0.00099951,0.00099763,0.00099575,0.00099389,0.00099205,0.00099021,0.00098839,0.00098658,0.00098478,0.000983,0.00098123,0.00097946,0.00097772,0.00097598,0.00097425,0.00097254,0.00097083,0.00096914,0.00096746,0.00096579,0.00096414,0.00096249,0.00096085,0.00095923,0.00095761,0.00095601,0.00095442,0.00095283,0.00095126,0.0009497,0.00094815,0.0009466,0.00094507,0.00094355,0.00094204,0.00094054,0.00093904,0.00093756,0.00093609,0.00093463,0.00093317,0.00093173,0.00093029,0.00092886,0.00092745,0.00092604,0.00092464,0.00092325,0.00092187,0.00092049,0.00091913,0.00091777,0.00091643,0.00091509,0.00091376,0.00091244,0.00091112,0.00090982,0.00090852,0.00090723,0.00090595,0.00090467,0.00090341,0.00090215,0.0009009,0.00089966,0.00089842,0.0008972,0.00089598,0.00089476,0.00089356,0.00089236,0.00089117,0.00088999,0.00088881,0.00088764,0.00088648,0.00088533,0.00088418,0.00088304,0.0008819,0.00088077,0.00087965,0.00087854,0.00087743,0.00087633,0.00087524,0.00087415,0.00087307,0.00087199,0.00087092,0.00086986,0.0008688,0.00086775,0.00086671,0.00086567,0.00086463,0.00086361,0.00086259,0.00086157,0.00086056,0.00085956,0.00085856,0.00085757,0.00085658,0.0008556,0.00085463,0.00085366,0.0008527,0.00085174,0.00085078,0.00084984,0.00084889,0.00084796,0.00084702,0.0008461,0.00084517,0.00084426,0.00084335,0.00084244,0.00084154,0.00084064,0.00083975,0.00083886,0.00083798,0.0008371,0.00083623,0.00083536,0.0008345,0.00083364,0.00083279,0.00083194,0.0008311,0.00083026,0.00082942,0.00082859,0.00082776,0.00082694,0.00082612,0.00082531,0.0008245,0.0008237,0.0008229,0.0008221,0.00082131,0.00082052,0.00081974,0.00081896,0.00081818,0.00081741,0.00081664,0.00081588,0.00081512,0.00081436,0.00081361,0.00081286,0.00081212,0.00081138,0.00081064,0.00080991,0.00080918,0.00080845,0.00080773,0.00080701,0.0008063,0.00080559,0.00080488,0.00080418,0.00080348,0.00080278,0.00080209,0.0008014,0.00080071,0.00080003,0.00079935,0.00079867,0.000798,0.00079733,0.00079666,0.000796,0.00079534,0.00079468,0.00079403,0.00079338,0.00079273,0.00079209,0.00079145,0.00079081,0.00079018,0.00078955,0.00078892,0.00078829,0.00078767,0.00078705,0.00078643,0.00078582,0.00078521,0.0007846,0.000784,0.00078339,0.0007828,0.0007822,0.00078161,0.00078101,0.00078043,0.00077984,0.00077926,0.00077868,0.0007781,0.00077753,0.00077696,0.00077639,0.00077582,0.00077526,0.0007747,0.00077414,0.00077358,0.00077303,0.00077248,0.00077193,0.00077138,0.00077084,0.0007703,0.00076976,0.00076922,0.00076869,0.00076816,0.00076763,0.0007671,0.00076658,0.00076605,0.00076553,0.00076502,0.0007645,0.00076399,0.00076348,0.00076297,0.00076246,0.00076196,0.00076146,0.00076096,0.00076046,0.00075997,0.00075947,0.00075898,0.00075849,0.00075801,0.00075752,0.00075704,0.00075656,0.00075608,0.00075561,0.00075513,0.00075466,0.00075419,0.00075372,0.00075326,0.00075279,0.00075233,0.00075187,0.00075141,0.00075095,0.0007505,0.00075005,0.0007496,0.00074915,0.0007487,0.00074826,0.00074781,0.00074737,0.00074693,0.0007465,0.00074606,0.00074563,0.00074519,0.00074476,0.00074434,0.00074391,0.00074348,0.00074306,0.00074264,0.00074222,0.0007418,0.00074138,0.00074097,0.00074056,0.00074014,0.00073973,0.00073933,0.00073892,0.00073851,0.00073811,0.00073771,0.00073731,0.00073691,0.00073651,0.00073612,0.00073573,0.00073533,0.00073494,0.00073455,0.00073417,0.00073378,0.0007334,0.00073301,0.00073263,0.00073225,0.00073187,0.0007315,0.00073112,0.00073075,0.00073037,0.00073,0.00072963,0.00072926,0.0007289,0.00072853,0.00072817,0.0007278,0.00072744,0.00072708,0.00072672,0.00072637,0.00072601,0.00072566,0.0007253,0.00072495,0.0007246,0.00072425,0.0007239,0.00072356,0.00072321,0.00072287,0.00072252,0.00072218,0.00072184,0.0007215,0.00072117,0.00072083,0.00072049,0.00072016,0.00071983,0.0007195,0.00071917,0.00071884,0.00071851,0.00071818,0.00071786,0.00071753,0.00071721,0.00071689,0.00071657,0.00071625,0.00071593,0.00071561,0.0007153,0.00071498,0.00071467,0.00071435,0.00071404,0.00071373,0.00071342,0.00071311,0.00071281,0.0007125,0.0007122,0.00071189,0.00071159,0.00071129,0.00071099,0.00071069,0.00071039,0.00071009,0.0007098,0.0007095,0.00070921,0.00070891,0.00070862,0.00070833,0.00070804,0.00070775,0.00070746,0.00070717,0.00070689,0.0007066,0.00070632,0.00070603,0.00070575,0.00070547,0.00070519,0.00070491,0.00070463,0.00070435,0.00070408,0.0007038,0.00070353,0.00070325,0.00070298,0.00070271,0.00070244,0.00070217,0.0007019,0.00070163,0.00070136,0.00070109,0.00070083,0.00070056,0.0007003,0.00070004,0.00069977,0.00069951,0.00069925,0.00069899,0.00069873,0.00069848,0.00069822,0.00069796,0.00069771,0.00069745,0.0006972,0.00069695,0.00069669,0.00069644,0.00069619,0.00069594,0.00069569,0.00069545,0.0006952,0.00069495,0.00069471,0.00069446,0.00069422,0.00069398,0.00069373,0.00069349,0.00069325,0.00069301,0.00069277,0.00069253,0.0006923,0.00069206,0.00069182,0.00069159,0.00069135,0.00069112,0.00069088,0.00069065,0.00069042,0.00069019,0.00068996,0.00068973,0.0006895,0.00068927,0.00068904,0.00068882,0.00068859,0.00068837,0.00068814,0.00068792,0.00068769,0.00068747,0.00068725,0.00068703,0.00068681,0.00068659,0.00068637,0.00068615,0.00068593,0.00068571,0.0006855,0.00068528,0.00068507,0.00068485,0.00068464,0.00068442,0.00068421,0.000684,0.00068379,0.00068358,0.00068337,0.00068316,0.00068295,0.00068274,0.00068253,0.00068233,0.00068212,0.00068191,0.00068171,0.0006815,0.0006813,0.0006811,0.00068089,0.00068069,0.00068049,0.00068029,0.00068009,0.00067989,0.00067969,0.00067949,0.00067929,0.0006791,0.0006789,0.0006787,0.00067851,0.00067831,0.00067812,0.00067792,0.00067773,0.00067754,0.00067735,0.00067715,0.00067696,0.00067677,0.00067658,0.00067639,0.0006762,0.00067602,0.00067583,0.00067564,0.00067545,0.00067527,0.00067508,0.0006749,0.00067471,0.00067453,0.00067434,0.00067416,0.00067398,0.0006738,0.00067361,0.00067343,0.00067325,0.00067307,0.00067289,0.00067271,0.00067253,0.00067236,0.00067218,0.000672,0.00067182,0.00067165,0.00067147,0.0006713,0.00067112,0.00067095,0.00067078,0.0006706,0.00067043,0.00067026,0.00067009,0.00066991,0.00066974,0.00066957,0.0006694,0.00066923,0.00066906,0.0006689,0.00066873,0.00066856,0.00066839,0.00066823,0.00066806,0.00066789,0.00066773,0.00066756,0.0006674,0.00066724,0.00066707,0.00066691,0.00066675,0.00066658,0.00066642,0.00066626,0.0006661,0.00066594,0.00066578,0.00066562,0.00066546,0.0006653,0.00066514,0.00066498,0.00066483,0.00066467,0.00066451,0.00066436,0.0006642,0.00066405,0.00066389,0.00066374,0.00066358,0.00066343,0.00066327,0.00066312,0.00066297,0.00066282,0.00066266,0.00066251,0.00066236,0.00066221,0.00066206,0.00066191,0.00066176,0.00066161,0.00066146,0.00066131,0.00066117,0.00066102,0.00066087,0.00066072,0.00066058,0.00066043,0.00066029,0.00066014,0.00065999,0.00065985,0.00065971,0.00065956,0.00065942,0.00065927,0.00065913,0.00065899,0.00065885,0.00065871,0.00065856,0.00065842,0.00065828,0.00065814,0.000658,0.00065786,0.00065772,0.00065758,0.00065745,0.00065731,0.00065717,0.00065703,0.00065689,0.00065676,0.00065662,0.00065648,0.00065635,0.00065621,0.00065608,0.00065594,0.00065581,0.00065567,0.00065554,0.00065541,0.00065527,0.00065514,0.00065501,0.00065488,0.00065474,0.00065461,0.00065448,0.00065435,0.00065422,0.00065409,0.00065396,0.00065383,0.0006537,0.00065357,0.00065344,0.00065331,0.00065318,0.00065306,0.00065293,0.0006528,0.00065267,0.00065255,0.00065242,0.0006523,0.00065217,0.00065204,0.00065192,0.00065179,0.00065167,0.00065155,0.00065142,0.0006513,0.00065117,0.00065105,0.00065093,0.00065081,0.00065068,0.00065056,0.00065044,0.00065032,0.0006502,0.00065008,0.00064996,0.00064984,0.00064972,0.0006496,0.00064948,0.00064936,0.00064924,0.00064912,0.000649,0.00064888,0.00064877,0.00064865,0.00064853,0.00064841,0.0006483,0.00064818,0.00064806,0.00064795,0.00064783,0.00064772,0.0006476,0.00064749,0.00064737,0.00064726,0.00064714,0.00064703,0.00064692,0.0006468,0.00064669,0.00064658,0.00064647,0.00064635,0.00064624,0.00064613,0.00064602,0.00064591,0.0006458,0.00064569,0.00064557,0.00064546,0.00064535,0.00064524,0.00064513,0.00064503,0.00064492,0.00064481,0.0006447,0.00064459,0.00064448,0.00064437,0.00064427,0.00064416,0.00064405,0.00064395,0.00064384,0.00064373,0.00064363,0.00064352,0.00064342,0.00064331,0.0006432,0.0006431,0.00064299,0.00064289,0.00064279,0.00064268,0.00064258,0.00064247,0.00064237,0.00064227,0.00064216,0.00064206,0.00064196,0.00064186,0.00064175,0.00064165,0.00064155,0.00064145,0.00064135,0.00064125,0.00064115,0.00064105,0.00064095,0.00064085,0.00064075,0.00064065,0.00064055,0.00064045,0.00064035,0.00064025,0.00064015,0.00064005,0.00063995,0.00063986,0.00063976,0.00063966,0.00063956,0.00063947,0.00063937,0.00063927,0.00063918,0.00063908,0.00063898,0.00063889,0.00063879,0.0006387,0.0006386,0.0006385,0.00063841,0.00063831,0.00063822,0.00063813,0.00063803,0.00063794,0.00063784,0.00063775,0.00063766,0.00063756,0.00063747,0.00063738,0.00063728,0.00063719,0.0006371,0.00063701,0.00063692,0.00063682,0.00063673,0.00063664,0.00063655,0.00063646,0.00063637,0.00063628,0.00063619,0.0006361,0.00063601,0.00063592,0.00063583,0.00063574,0.00063565,0.00063556,0.00063547,0.00063538,0.00063529,0.00063521,0.00063512,0.00063503,0.00063494,0.00063485,0.00063477,0.00063468,0.00063459,0.0006345,0.00063442,0.00063433,0.00063424,0.00063416,0.00063407,0.00063399,0.0006339,0.00063381,0.00063373,0.00063364,0.00063356,0.00063347,0.00063339,0.0006333,0.00063322,0.00063314,0.00063305,0.00063297,0.00063288,0.0006328,0.00063272,0.00063263,0.00063255,0.00063247,0.00063238,0.0006323,0.00063222,0.00063214,0.00063206,0.00063197,0.00063189,0.00063181,0.00063173,0.00063165,0.00063157,0.00063148,0.0006314,0.00063132,0.00063124,0.00063116,0.00063108,0.000631,0.00063092,0.00063084,0.00063076,0.00063068,0.0006306,0.00063052,0.00063045,0.00063037,0.00063029,0.00063021,0.00063013,0.00063005,0.00062997,0.0006299,0.00062982,0.00062974,0.00062966,0.00062959,0.00062951,0.00062943,0.00062935,0.00062928,0.0006292,0.00062912,0.00062905,0.00062897,0.0006289,0.00062882,0.00062874,0.00062867,0.00062859,0.00062852,0.00062844,0.00062837,0.00062829,0.00062822,0.00062814,0.00062807,0.00062799,0.00062792,0.00062785,0.00062777,0.0006277,0.00062762,0.00062755,0.00062748,0.0006274,0.00062733,0.00062726,0.00062718,0.00062711,0.00062704,0.00062697,0.00062689,0.00062682,0.00062675,0.00062668,0.00062661,0.00062653,0.00062646,0.00062639,0.00062632,0.00062625,0.00062618,0.00062611,0.00062604,0.00062596,0.00062589,0.00062582,0.00062575,0.00062568,0.00062561,0.00062554,0.00062547,0.0006254,0.00062533,0.00062527,0.0006252,0.00062513,0.00062506,0.00062499,0.00062492,0.00062485,0.00062478,0.00062471,0.00062465,0.00062458,0.00062451,0.00062444,0.00062437,0.00062431,0.00062424,0.00062417,0.0006241,0.00062404,0.00062397,0.0006239,0.00062384,0.00062377,0.0006237,0.00062364,0.00062357,0.0006235,0.00062344,0.00062337,0.00062331,0.00062324,0.00062317,0.00062311,0.00062304,0.00062298,0.00062291,0.00062285,0.00062278,0.00062272,0.00062265,0.00062259,0.00062252,0.00062246,0.00062239,0.00062233,0.00062227,0.0006222,0.00062214,0.00062207,0.00062201,0.00062195,0.00062188,0.00062182,0.00062176,0.00062169,0.00062163,0.00062157,0.00062151,0.00062144,0.00062138,0.00062132,0.00062126,0.00062119,0.00062113,0.00062107,0.00062101,0.00062095,0.00062088,0.00062082,0.00062076,0.0006207,0.00062064,0.00062058,0.00062052,0.00062045,0.00062039,0.00062033,0.00062027,0.00062021,0.00062015,0.00062009,0.00062003,0.00061997,0.00061991,0.00061985,0.00061979,0.00061973,0.00061967,0.00061961,0.00061955,0.00061949,0.00061943,0.00061937,0.00061931,0.00061926,0.0006192,0.00061914,0.00061908,0.00061902,0.00061896,0.0006189,0.00061885,0.00061879,0.00061873,0.00061867,0.00061861,0.00061856,0.0006185,0.00061844,0.00061838,0.00061832,0.00061827,0.00061821,0.00061815,0.0006181,0.00061804,0.00061798,0.00061793,0.00061787,0.00061781,0.00061776,0.0006177,0.00061764,0.00061759,0.00061753,0.00061747,0.00061742,0.00061736,0.00061731,0.00061725,0.0006172,0.00061714,0.00061708,0.00061703,0.00061697,0.00061692,0.00061686,0.00061681,0.00061675,0.0006167,0.00061664,0.00061659,0.00061654,0.00061648,0.00061643,0.00061637,0.00061632,0.00061626,0.00061621,0.00061616,0.0006161,0.00061605,0.00061599,0.00061594,0.00061589,0.00061583,0.00061578,0.00061573,0.00061567,0.00061562,0.00061557,0.00061552,0.00061546,0.00061541,0.00061536,0.0006153,0.00061525,0.0006152,0.00061515,0.0006151,0.00061504,0.00061499,0.00061494,0.00061489,0.00061484,0.00061478,0.00061473,0.00061468,0.00061463,0.00061458,0.00061453,0.00061447,0.00061442,0.00061437,0.00061432,0.00061427,0.00061422,0.00061417,0.00061412,0.00061407,0.00061402,0.00061397,0.00061392,0.00061387,0.00061382,0.00061377,0.00061372,0.00061367,0.00061362,0.00061357,0.00061352,0.00061347,0.00061342,0.00061337,0.00061332,0.00061327,0.00061322,0.00061317,0.00061312,0.00061307,0.00061302,0.00061297,0.00061292,0.00061288,0.00061283,0.00061278,0.00061273,0.00061268,0.00061263,0.00061258,0.00061254,0.00061249,0.00061244,0.00061239,0.00061234,0.0006123,0.00061225,0.0006122,0.00061215,0.0006121,0.00061206,0.00061201,0.00061196,0.00061191,0.00061187,0.00061182,0.00061177,0.00061173,0.00061168,0.00061163,0.00061158,0.00061154,0.00061149,0.00061144,0.0006114,0.00061135,0.00061131,0.00061126,0.00061121,0.00061117,0.00061112,0.00061107,0.00061103,0.00061098,0.00061094,0.00061089,0.00061084,0.0006108,0.00061075,0.00061071,0.00061066,0.00061062,0.00061057,0.00061053,0.00061048,0.00061044,0.00061039,0.00061035,0.0006103,0.00061026,0.00061021,0.00061017,0.00061012,0.00061008,0.00061003,0.00060999,0.00060994,0.0006099,0.00060985,0.00060981,0.00060977,0.00060972,0.00060968,0.00060963,0.00060959,0.00060955,0.0006095,0.00060946,0.00060941,0.00060937,0.00060933,0.00060928,0.00060924,0.0006092,0.00060915,0.00060911,0.00060907,0.00060902,0.00060898,0.00060894,0.0006089,0.00060885,0.00060881,0.00060877,0.00060872,0.00060868,0.00060864,0.0006086,0.00060855,0.00060851,0.00060847,0.00060843,0.00060839,0.00060834,0.0006083,0.00060826,0.00060822,0.00060817,0.00060813,0.00060809,0.00060805,0.00060801,0.00060797,0.00060792,0.00060788,0.00060784,0.0006078,0.00060776,0.00060772,0.00060768,0.00060764,0.00060759,0.00060755,0.00060751,0.00060747,0.00060743,0.00060739,0.00060735,0.00060731,0.00060727,0.00060723,0.00060719,0.00060715,0.00060711,0.00060707,0.00060703,0.00060699,0.00060694,0.0006069,0.00060686,0.00060682,0.00060678,0.00060674,0.0006067,0.00060667,0.00060663,0.00060659,0.00060655,0.00060651,0.00060647,0.00060643,0.00060639,0.00060635,0.00060631,0.00060627,0.00060623,0.00060619,0.00060615,0.00060611,0.00060607,0.00060604,0.000606,0.00060596,0.00060592,0.00060588,0.00060584,0.0006058,0.00060576,0.00060573,0.00060569,0.00060565,0.00060561,0.00060557,0.00060553,0.0006055,0.00060546,0.00060542,0.00060538,0.00060534,0.00060531,0.00060527,0.00060523,0.00060519,0.00060515,0.00060512,0.00060508,0.00060504,0.000605,0.00060497,0.00060493,0.00060489,0.00060485,0.00060482,0.00060478,0.00060474,0.00060471,0.00060467,0.00060463,0.00060459,0.00060456,0.00060452,0.00060448,0.00060445,0.00060441,0.00060437,0.00060434,0.0006043,0.00060426,0.00060423,0.00060419,0.00060415,0.00060412,0.00060408,0.00060405,0.00060401,0.00060397,0.00060394,0.0006039,0.00060387,0.00060383,0.00060379,0.00060376,0.00060372,0.00060369,0.00060365,0.00060361,0.00060358,0.00060354,0.00060351,0.00060347,0.00060344,0.0006034,0.00060337,0.00060333,0.0006033,0.00060326,0.00060323,0.00060319,0.00060315,0.00060312,0.00060308,0.00060305,0.00060301,0.00060298,0.00060295,0.00060291,0.00060288,0.00060284,0.00060281,0.00060277,0.00060274,0.0006027,0.00060267,0.00060263,0.0006026,0.00060257,0.00060253,0.0006025,0.00060246,0.00060243,0.00060239,0.00060236,0.00060233,0.00060229,0.00060226,0.00060222,0.00060219,0.00060216,0.00060212,0.00060209,0.00060206,0.00060202,0.00060199,0.00060195,0.00060192,0.00060189,0.00060185,0.00060182,0.00060179,0.00060175,0.00060172,0.00060169,0.00060165,0.00060162,0.00060159,0.00060156,0.00060152,0.00060149,0.00060146,0.00060142,0.00060139,0.00060136,0.00060133,0.00060129,0.00060126,0.00060123,0.00060119,0.00060116,0.00060113,0.0006011,0.00060106,0.00060103,0.000601,0.00060097,0.00060094,0.0006009,0.00060087,0.00060084,0.00060081,0.00060077,0.00060074,0.00060071,0.00060068,0.00060065,0.00060061,0.00060058,0.00060055,0.00060052,0.00060049,0.00060046,0.00060042,0.00060039,0.00060036,0.00060033,0.0006003,0.00060027,0.00060024,0.0006002,0.00060017,0.00060014,0.00060011,0.00060008,0.00060005,0.00060002,0.00059999,0.00059995,0.00059992,0.00059989,0.00059986,0.00059983,0.0005998,0.00059977,0.00059974,0.00059971,0.00059968,0.00059965,0.00059962,0.00059959,0.00059955,0.00059952,0.00059949,0.00059946,0.00059943,0.0005994,0.00059937,0.00059934,0.00059931,0.00059928,0.00059925,0.00059922,0.00059919,0.00059916,0.00059913,0.0005991,0.00059907,0.00059904,0.00059901,0.00059898,0.00059895,0.00059892,0.00059889,0.00059886,0.00059883,0.0005988,0.00059877,0.00059874,0.00059871,0.00059868,0.00059865,0.00059863,0.0005986,0.00059857,0.00059854,0.00059851,0.00059848,0.00059845,0.00059842,0.00059839,0.00059836,0.00059833,0.0005983,0.00059827,0.00059825,0.00059822,0.00059819,0.00059816,0.00059813,0.0005981,0.00059807,0.00059804,0.00059801,0.00059799,0.00059796,0.00059793,0.0005979,0.00059787,0.00059784,0.00059781,0.00059779,0.00059776,0.00059773,0.0005977,0.00059767,0.00059764,0.00059762,0.00059759,0.00059756,0.00059753,0.0005975,0.00059748,0.00059745,0.00059742,0.00059739,0.00059736,0.00059734,0.00059731,0.00059728,0.00059725,0.00059722,0.0005972,0.00059717,0.00059714,0.00059711,0.00059709,0.00059706,0.00059703,0.000597,0.00059698,0.00059695,0.00059692,0.00059689,0.00059687,0.00059684,0.00059681,0.00059678,0.00059676,0.00059673,0.0005967,0.00059667,0.00059665,0.00059662,0.00059659,0.00059657,0.00059654,0.00059651,0.00059649,0.00059646,0.00059643,0.0005964,0.00059638,0.00059635,0.00059632,0.0005963,0.00059627,0.00059624,0.00059622,0.00059619,0.00059616,0.00059614,0.00059611,0.00059608,0.00059606,0.00059603,0.00059601,0.00059598,0.00059595,0.00059593,0.0005959,0.00059587,0.00059585,0.00059582,0.0005958,0.00059577,0.00059574,0.00059572,0.00059569,0.00059567,0.00059564,0.00059561,0.00059559,0.00059556,0.00059554,0.00059551,0.00059548,0.00059546,0.00059543,0.00059541,0.00059538,0.00059536,0.00059533,0.0005953,0.00059528,0.00059525,0.00059523,0.0005952,0.00059518,0.00059515,0.00059513,0.0005951,0.00059507,0.00059505,0.00059502,0.000595,0.00059497,0.00059495,0.00059492,0.0005949,0.00059487,0.00059485,0.00059482,0.0005948,0.00059477,0.00059475,0.00059472,0.0005947,0.00059467,0.00059465,0.00059462,0.0005946,0.00059457,0.00059455,0.00059452,0.0005945,0.00059447,0.00059445,0.00059443,0.0005944,0.00059438,0.00059435,0.00059433,0.0005943,0.00059428,0.00059425,0.00059423,0.0005942,0.00059418,0.00059416,0.00059413,0.00059411,0.00059408,0.00059406,0.00059403,0.00059401,0.00059399,0.00059396,0.00059394,0.00059391,0.00059389,0.00059387,0.00059384,0.00059382,0.00059379,0.00059377,0.00059375,0.00059372,0.0005937,0.00059367,0.00059365,0.00059363,0.0005936,0.00059358,0.00059356,0.00059353,0.00059351,0.00059348,0.00059346,0.00059344,0.00059341,0.00059339,0.00059337,0.00059334,0.00059332,0.0005933,0.00059327,0.00059325,0.00059323,0.0005932,0.00059318,0.00059316,0.00059313,0.00059311,0.00059309,0.00059306,0.00059304,0.00059302,0.00059299,0.00059297,0.00059295,0.00059293,0.0005929,0.00059288,0.00059286,0.00059283,0.00059281,0.00059279,0.00059276,0.00059274,0.00059272,0.0005927,0.00059267,0.00059265,0.00059263,0.00059261,0.00059258,0.00059256,0.00059254,0.00059251,0.00059249,0.00059247,0.00059245,0.00059242,0.0005924,0.00059238,0.00059236,0.00059233,0.00059231,0.00059229,0.00059227,0.00059225,0.00059222,0.0005922,0.00059218,0.00059216,0.00059213,0.00059211,0.00059209,0.00059207,0.00059205,0.00059202,0.000592,0.00059198,0.00059196,0.00059194,0.00059191,0.00059189,0.00059187,0.00059185,0.00059183,0.0005918,0.00059178,0.00059176,0.00059174,0.00059172,0.0005917,0.00059167,0.00059165,0.00059163,0.00059161,0.00059159,0.00059157,0.00059154,0.00059152,0.0005915,0.00059148,0.00059146,0.00059144,0.00059141,0.00059139,0.00059137,0.00059135,0.00059133,0.00059131,0.00059129,0.00059127,0.00059124,0.00059122,0.0005912,0.00059118,0.00059116,0.00059114,0.00059112,0.0005911,0.00059107,0.00059105,0.00059103,0.00059101,0.00059099,0.00059097,0.00059095,0.00059093,0.00059091,0.00059089,0.00059086,0.00059084,0.00059082,0.0005908,0.00059078,0.00059076,0.00059074,0.00059072,0.0005907,0.00059068,0.00059066,0.00059064,0.00059062,0.00059059,0.00059057,0.00059055,0.00059053,0.00059051,0.00059049,0.00059047,0.00059045,0.00059043,0.00059041,0.00059039,0.00059037,0.00059035,0.00059033,0.00059031,0.00059029,0.00059027,0.00059025,0.00059023,0.00059021,0.00059019,0.00059017,0.00059015,0.00059013,0.00059011,0.00059009,0.00059007,0.00059005,0.00059003,0.00059001,0.00058999,0.00058997,0.00058995,0.00058993,0.00058991,0.00058989,0.00058987,0.00058985,0.00058983,0.00058981,0.00058979,0.00058977,0.00058975,0.00058973,0.00058971,0.00058969,0.00058967,0.00058965,0.00058963,0.00058961,0.00058959,0.00058957,0.00058955,0.00058953,0.00058951,0.00058949,0.00058947,0.00058945,0.00058943,0.00058941,0.00058939,0.00058937,0.00058936,0.00058934,0.00058932,0.0005893,0.00058928,0.00058926,0.00058924,0.00058922,0.0005892,0.00058918,0.00058916,0.00058914,0.00058912,0.0005891,0.00058909,0.00058907,0.00058905,0.00058903,0.00058901,0.00058899,0.00058897,0.00058895,0.00058893,0.00058891,0.0005889,0.00058888,0.00058886,0.00058884,0.00058882,0.0005888,0.00058878,0.00058876,0.00058874,0.00058873,0.00058871,0.00058869,0.00058867,0.00058865,0.00058863,0.00058861,0.00058859,0.00058858,0.00058856,0.00058854,0.00058852,0.0005885,0.00058848,0.00058846,0.00058845,0.00058843,0.00058841,0.00058839,0.00058837,0.00058835,0.00058834,0.00058832,0.0005883,0.00058828,0.00058826,0.00058824,0.00058822,0.00058821,0.00058819,0.00058817,0.00058815,0.00058813,0.00058812,0.0005881,0.00058808,0.00058806,0.00058804,0.00058802,0.00058801,0.00058799,0.00058797,0.00058795,0.00058793,0.00058792,0.0005879,0.00058788,0.00058786,0.00058784,0.00058783,0.00058781,0.00058779,0.00058777,0.00058775,0.00058774,0.00058772,0.0005877,0.00058768,0.00058767,0.00058765,0.00058763,0.00058761,0.00058759,0.00058758,0.00058756,0.00058754,0.00058752,0.00058751,0.00058749,0.00058747,0.00058745,0.00058744,0.00058742,0.0005874,0.00058738,0.00058737,0.00058735,0.00058733,0.00058731,0.0005873,0.00058728,0.00058726,0.00058724,0.00058723,0.00058721,0.00058719,0.00058717,0.00058716,0.00058714,0.00058712,0.00058711,0.00058709,0.00058707,0.00058705,0.00058704,0.00058702,0.000587,0.00058698,0.00058697,0.00058695,0.00058693,0.00058692,0.0005869,0.00058688,0.00058687,0.00058685,0.00058683,0.00058681,0.0005868,0.00058678,0.00058676,0.00058675,0.00058673,0.00058671,0.0005867,0.00058668,0.00058666,0.00058665,0.00058663,0.00058661,0.00058659,0.00058658,0.00058656,0.00058654,0.00058653,0.00058651,0.00058649,0.00058648,0.00058646,0.00058644,0.00058643,0.00058641,0.00058639,0.00058638,0.00058636,0.00058634,0.00058633,0.00058631,0.00058629,0.00058628,0.00058626,0.00058625,0.00058623,0.00058621,0.0005862,0.00058618,0.00058616,0.00058615,0.00058613,0.00058611,0.0005861,0.00058608,0.00058606,0.00058605,0.00058603,0.00058602,0.000586,0.00058598,0.00058597,0.00058595,0.00058593,0.00058592,0.0005859,0.00058589,0.00058587,0.00058585,0.00058584,0.00058582,0.00058581,0.00058579,0.00058577,0.00058576,0.00058574,0.00058573,0.00058571,0.00058569,0.00058568,0.00058566,0.00058565,0.00058563,0.00058561,0.0005856,0.00058558,0.00058557,0.00058555,0.00058553,0.00058552,0.0005855,0.00058549,0.00058547,0.00058546,0.00058544,0.00058542,0.00058541,0.00058539,0.00058538,0.00058536,0.00058535,0.00058533,0.00058531,0.0005853,0.00058528,0.00058527,0.00058525,0.00058524,0.00058522,0.0005852,0.00058519,0.00058517,0.00058516,0.00058514,0.00058513,0.00058511,0.0005851,0.00058508,0.00058507,0.00058505,0.00058503,0.00058502,0.000585,0.00058499,0.00058497,0.00058496,0.00058494,0.00058493,0.00058491,0.0005849,0.00058488,0.00058487,0.00058485,0.00058484,0.00058482,0.0005848,0.00058479,0.00058477,0.00058476,0.00058474,0.00058473,0.00058471,0.0005847,0.00058468,0.00058467,0.00058465,0.00058464,0.00058462,0.00058461,0.00058459,0.00058458,0.00058456,0.00058455,0.00058453,0.00058452,0.0005845,0.00058449,0.00058447,0.00058446,0.00058444,0.00058443,0.00058441,0.0005844,0.00058438,0.00058437,0.00058435,0.00058434,0.00058432,0.00058431,0.0005843,0.00058428,0.00058427,0.00058425,0.00058424,0.00058422,0.00058421,0.00058419,0.00058418,0.00058416,0.00058415,0.00058413,0.00058412,0.0005841,0.00058409,0.00058408,0.00058406,0.00058405,0.00058403,0.00058402,0.000584,0.00058399,0.00058397,0.00058396,0.00058394,0.00058393,0.00058392,0.0005839,0.00058389,0.00058387,0.00058386,0.00058384,0.00058383,0.00058381,0.0005838,0.00058379,0.00058377,0.00058376,0.00058374,0.00058373,0.00058371,0.0005837,0.00058369,0.00058367,0.00058366,0.00058364,0.00058363,0.00058361,0.0005836,0.00058359,0.00058357,0.00058356,0.00058354,0.00058353,0.00058352,0.0005835,0.00058349,0.00058347,0.00058346,0.00058345,0.00058343,0.00058342,0.0005834,0.00058339,0.00058338,0.00058336,0.00058335,0.00058333,0.00058332,0.00058331,0.00058329,0.00058328,0.00058326,0.00058325,0.00058324,0.00058322,0.00058321,0.00058319,0.00058318,0.00058317,0.00058315,0.00058314,0.00058313,0.00058311,0.0005831,0.00058308,0.00058307,0.00058306,0.00058304,0.00058303,0.00058302,0.000583,0.00058299,0.00058297,0.00058296,0.00058295,0.00058293,0.00058292,0.00058291,0.00058289,0.00058288,0.00058287,0.00058285,0.00058284,0.00058282,0.00058281,0.0005828,0.00058278,0.00058277,0.00058276,0.00058274,0.00058273,0.00058272,0.0005827,0.00058269,0.00058268,0.00058266,0.00058265,0.00058264,0.00058262,0.00058261,0.0005826,0.00058258,0.00058257,0.00058256,0.00058254,0.00058253,0.00058252,0.0005825,0.00058249,0.00058248,0.00058246,0.00058245,0.00058244,0.00058242,0.00058241,0.0005824,0.00058238,0.00058237,0.00058236,0.00058234,0.00058233,0.00058232,0.0005823,0.00058229,0.00058228,0.00058227,0.00058225,0.00058224,0.00058223,0.00058221,0.0005822,0.00058219,0.00058217,0.00058216,0.00058215,0.00058214,0.00058212,0.00058211,0.0005821,0.00058208,0.00058207,0.00058206,0.00058204,0.00058203,0.00058202,0.00058201,0.00058199,0.00058198,0.00058197,0.00058195,0.00058194,0.00058193,0.00058192,0.0005819,0.00058189,0.00058188,0.00058186,0.00058185,0.00058184,0.00058183,0.00058181,0.0005818,0.00058179,0.00058178,0.00058176,0.00058175,0.00058174,0.00058172,0.00058171,0.0005817,0.00058169,0.00058167,0.00058166,0.00058165,0.00058164,0.00058162,0.00058161,0.0005816,0.00058159,0.00058157,0.00058156,0.00058155,0.00058154,0.00058152,0.00058151,0.0005815,0.00058149,0.00058147,0.00058146,0.00058145,0.00058144,0.00058142,0.00058141,0.0005814,0.00058139,0.00058137,0.00058136,0.00058135,0.00058134,0.00058132,0.00058131,0.0005813,0.00058129,0.00058128,0.00058126,0.00058125,0.00058124,0.00058123,0.00058121,0.0005812,0.00058119,0.00058118,0.00058117,0.00058115,0.00058114,0.00058113,0.00058112,0.0005811,0.00058109,0.00058108,0.00058107,0.00058106,0.00058104,0.00058103,0.00058102,0.00058101,0.000581,0.00058098,0.00058097,0.00058096,0.00058095,0.00058093,0.00058092,0.00058091,0.0005809,0.00058089,0.00058087,0.00058086,0.00058085,0.00058084,0.00058083,0.00058081,0.0005808,0.00058079,0.00058078,0.00058077,0.00058076,0.00058074,0.00058073,0.00058072,0.00058071,0.0005807,0.00058068,0.00058067,0.00058066,0.00058065,0.00058064,0.00058062,0.00058061,0.0005806,0.00058059,0.00058058,0.00058057,0.00058055,0.00058054,0.00058053,0.00058052,0.00058051,0.0005805,0.00058048,0.00058047,0.00058046,0.00058045,0.00058044,0.00058043,0.00058041,0.0005804,0.00058039,0.00058038,0.00058037,0.00058036,0.00058034,0.00058033,0.00058032,0.00058031,0.0005803,0.00058029,0.00058027,0.00058026,0.00058025,0.00058024,0.00058023,0.00058022,0.00058021,0.00058019,0.00058018,0.00058017,0.00058016,0.00058015,0.00058014,0.00058013,0.00058011,0.0005801,0.00058009,0.00058008,0.00058007,0.00058006,0.00058005,0.00058003,0.00058002,0.00058001,0.00058,0.00057999,0.00057998,0.00057997,0.00057996,0.00057994,0.00057993,0.00057992,0.00057991,0.0005799,0.00057989,0.00057988,0.00057986,0.00057985,0.00057984,0.00057983,0.00057982,0.00057981,0.0005798,0.00057979,0.00057978,0.00057976,0.00057975,0.00057974,0.00057973,0.00057972,0.00057971,0.0005797,0.00057969,0.00057968,0.00057966,0.00057965,0.00057964,0.00057963,0.00057962,0.00057961,0.0005796,0.00057959,0.00057958,0.00057956,0.00057955,0.00057954,0.00057953,0.00057952,0.00057951,0.0005795,0.00057949,0.00057948,0.00057947,0.00057946,0.00057944,0.00057943,0.00057942,0.00057941,0.0005794,0.00057939,0.00057938,0.00057937,0.00057936,0.00057935,0.00057934,0.00057932,0.00057931,0.0005793,0.00057929,0.00057928,0.00057927,0.00057926,0.00057925,0.00057924,0.00057923,0.00057922,0.00057921,0.0005792,0.00057918,0.00057917,0.00057916,0.00057915,0.00057914,0.00057913,0.00057912,0.00057911,0.0005791,0.00057909,0.00057908,0.00057907,0.00057906,0.00057905,0.00057903,0.00057902,0.00057901,0.000579,0.00057899,0.00057898,0.00057897,0.00057896,0.00057895,0.00057894,0.00057893,0.00057892,0.00057891,0.0005789,0.00057889,0.00057888,0.00057887,0.00057886,0.00057885,0.00057883,0.00057882,0.00057881,0.0005788,0.00057879,0.00057878,0.00057877,0.00057876,0.00057875,0.00057874,0.00057873,0.00057872,0.00057871,0.0005787,0.00057869,0.00057868,0.00057867,0.00057866,0.00057865,0.00057864,0.00057863,0.00057862,0.00057861,0.0005786,0.00057859,0.00057858,0.00057856,0.00057855,0.00057854,0.00057853,0.00057852,0.00057851,0.0005785,0.00057849,0.00057848,0.00057847,0.00057846,0.00057845,0.00057844,0.00057843,0.00057842,0.00057841,0.0005784,0.00057839,0.00057838,0.00057837,0.00057836,0.00057835,0.00057834,0.00057833,0.00057832,0.00057831,0.0005783,0.00057829,0.00057828,0.00057827,0.00057826,0.00057825,0.00057824,0.00057823,0.00057822,0.00057821,0.0005782,0.00057819,0.00057818,0.00057817,0.00057816,0.00057815,0.00057814,0.00057813,0.00057812,0.00057811,0.0005781,0.00057809,0.00057808,0.00057807,0.00057806,0.00057805,0.00057804,0.00057803,0.00057802,0.00057801,0.000578,0.00057799,0.00057798,0.00057797,0.00057796,0.00057795,0.00057794,0.00057793,0.00057792,0.00057791,0.0005779,0.00057789,0.00057788,0.00057787,0.00057786,0.00057785,0.00057784,0.00057783,0.00057782,0.00057781,0.0005778,0.00057779,0.00057778,0.00057777,0.00057777,0.00057776,0.00057775,0.00057774,0.00057773,0.00057772,0.00057771,0.0005777,0.00057769,0.00057768,0.00057767,0.00057766,0.00057765,0.00057764,0.00057763,0.00057762,0.00057761,0.0005776,0.00057759,0.00057758,0.00057757,0.00057756,0.00057755,0.00057754,0.00057753,0.00057752,0.00057751,0.00057751,0.0005775,0.00057749,0.00057748,0.00057747,0.00057746,0.00057745,0.00057744,0.00057743,0.00057742,0.00057741,0.0005774,0.00057739,0.00057738,0.00057737,0.00057736,0.00057735,0.00057734,0.00057733,0.00057733,0.00057732,0.00057731,0.0005773,0.00057729,0.00057728,0.00057727,0.00057726,0.00057725,0.00057724,0.00057723,0.00057722,0.00057721,0.0005772,0.00057719,0.00057718,0.00057718,0.00057717,0.00057716,0.00057715,0.00057714,0.00057713,0.00057712,0.00057711,0.0005771,0.00057709,0.00057708,0.00057707,0.00057706,0.00057705,0.00057705,0.00057704,0.00057703,0.00057702,0.00057701,0.000577,0.00057699,0.00057698,0.00057697,0.00057696,0.00057695,0.00057694,0.00057694,0.00057693,0.00057692,0.00057691,0.0005769,0.00057689,0.00057688,0.00057687,0.00057686,0.00057685,0.00057684,0.00057683,0.00057683,0.00057682,0.00057681,0.0005768,0.00057679,0.00057678,0.00057677,0.00057676,0.00057675,0.00057674,0.00057674,0.00057673,0.00057672,0.00057671,0.0005767,0.00057669,0.00057668,0.00057667,0.00057666,0.00057665,0.00057665,0.00057664,0.00057663,0.00057662,0.00057661,0.0005766,0.00057659,0.00057658,0.00057657,0.00057657,0.00057656,0.00057655,0.00057654,0.00057653,0.00057652,0.00057651,0.0005765,0.00057649,0.00057649,0.00057648,0.00057647,0.00057646,0.00057645,0.00057644,0.00057643,0.00057642,0.00057641,0.00057641,0.0005764,0.00057639,0.00057638,0.00057637,0.00057636,0.00057635,0.00057634,0.00057634,0.00057633,0.00057632,0.00057631,0.0005763,0.00057629,0.00057628,0.00057627,0.00057627,0.00057626,0.00057625,0.00057624,0.00057623,0.00057622,0.00057621,0.0005762,0.0005762,0.00057619,0.00057618,0.00057617,0.00057616,0.00057615,0.00057614,0.00057614,0.00057613,0.00057612,0.00057611,0.0005761,0.00057609,0.00057608,0.00057608,0.00057607,0.00057606,0.00057605,0.00057604,0.00057603,0.00057602,0.00057602,0.00057601,0.000576,0.00057599,0.00057598,0.00057597,0.00057596,0.00057596,0.00057595,0.00057594,0.00057593,0.00057592,0.00057591,0.00057591,0.0005759,0.00057589,0.00057588,0.00057587,0.00057586,0.00057585,0.00057585,0.00057584,0.00057583,0.00057582,0.00057581,0.0005758,0.0005758,0.00057579,0.00057578,0.00057577,0.00057576,0.00057575,0.00057575,0.00057574,0.00057573,0.00057572,0.00057571,0.0005757,0.0005757,0.00057569,0.00057568,0.00057567,0.00057566,0.00057565,0.00057565,0.00057564,0.00057563,0.00057562,0.00057561,0.0005756,0.0005756,0.00057559,0.00057558,0.00057557,0.00057556,0.00057555,0.00057555,0.00057554,0.00057553,0.00057552,0.00057551,0.0005755,0.0005755,0.00057549,0.00057548,0.00057547,0.00057546,0.00057546,0.00057545,0.00057544,0.00057543,0.00057542,0.00057541,0.00057541,0.0005754,0.00057539,0.00057538,0.00057537,0.00057537,0.00057536,0.00057535,0.00057534,0.00057533,0.00057533,0.00057532,0.00057531,0.0005753,0.00057529,0.00057528,0.00057528,0.00057527,0.00057526,0.00057525,0.00057524,0.00057524,0.00057523,0.00057522,0.00057521,0.0005752,0.0005752,0.00057519,0.00057518,0.00057517,0.00057516,0.00057516,0.00057515,0.00057514,0.00057513,0.00057512,0.00057512,0.00057511,0.0005751,0.00057509,0.00057508,0.00057508,0.00057507,0.00057506,0.00057505,0.00057505,0.00057504,0.00057503,0.00057502,0.00057501,0.00057501,0.000575,0.00057499,0.00057498,0.00057497,0.00057497,0.00057496,0.00057495,0.00057494,0.00057493,0.00057493,0.00057492,0.00057491,0.0005749,0.0005749,0.00057489,0.00057488,0.00057487,0.00057486,0.00057486,0.00057485,0.00057484,0.00057483,0.00057483,0.00057482,0.00057481,0.0005748,0.00057479,0.00057479,0.00057478,0.00057477,0.00057476,0.00057476,0.00057475,0.00057474,0.00057473,0.00057472,0.00057472,0.00057471,0.0005747,0.00057469,0.00057469,0.00057468,0.00057467,0.00057466,0.00057466,0.00057465,0.00057464,0.00057463,0.00057462,0.00057462,0.00057461,0.0005746,0.00057459,0.00057459,0.00057458,0.00057457,0.00057456,0.00057456,0.00057455,0.00057454,0.00057453,0.00057453,0.00057452,0.00057451,0.0005745,0.00057449,0.00057449,0.00057448,0.00057447,0.00057446,0.00057446,0.00057445,0.00057444,0.00057443,0.00057443,0.00057442,0.00057441,0.0005744,0.0005744,0.00057439,0.00057438,0.00057437,0.00057437,0.00057436,0.00057435,0.00057434,0.00057434,0.00057433,0.00057432,0.00057431,0.00057431,0.0005743,0.00057429,0.00057428,0.00057428,0.00057427,0.00057426,0.00057425,0.00057425,0.00057424,0.00057423,0.00057423,0.00057422,0.00057421,0.0005742,0.0005742,0.00057419,0.00057418,0.00057417,0.00057417,0.00057416,0.00057415,0.00057414,0.00057414,0.00057413,0.00057412,0.00057411,0.00057411,0.0005741,0.00057409,0.00057409,0.00057408,0.00057407,0.00057406,0.00057406,0.00057405,0.00057404,0.00057403,0.00057403,0.00057402,0.00057401,0.000574,0.000574,0.00057399,0.00057398,0.00057398,0.00057397,0.00057396,0.00057395,0.00057395,0.00057394,0.00057393,0.00057392,0.00057392,0.00057391,0.0005739,0.0005739,0.00057389,0.00057388,0.00057387,0.00057387,0.00057386,0.00057385,0.00057385,0.00057384,0.00057383,0.00057382,0.00057382,0.00057381,0.0005738,0.0005738,0.00057379,0.00057378,0.00057377,0.00057377,0.00057376,0.00057375,0.00057375,0.00057374,0.00057373,0.00057372,0.00057372,0.00057371,0.0005737,0.0005737,0.00057369,0.00057368,0.00057367,0.00057367,0.00057366,0.00057365,0.00057365,0.00057364,0.00057363,0.00057362,0.00057362,0.00057361,0.0005736,0.0005736,0.00057359,0.00057358,0.00057358,0.00057357,0.00057356,0.00057355,0.00057355,0.00057354,0.00057353,0.00057353,0.00057352,0.00057351,0.00057351,0.0005735,0.00057349,0.00057348,0.00057348,0.00057347,0.00057346,0.00057346,0.00057345,0.00057344,0.00057344,0.00057343,0.00057342,0.00057342,0.00057341,0.0005734,0.00057339,0.00057339,0.00057338,0.00057337,0.00057337,0.00057336,0.00057335,0.00057335,0.00057334,0.00057333,0.00057333,0.00057332,0.00057331,0.0005733,0.0005733,0.00057329,0.00057328,0.00057328,0.00057327,0.00057326,0.00057326,0.00057325,0.00057324,0.00057324,0.00057323,0.00057322,0.00057322,0.00057321,0.0005732,0.0005732,0.00057319,0.00057318,0.00057317,0.00057317,0.00057316,0.00057315,0.00057315,0.00057314,0.00057313,0.00057313,0.00057312,0.00057311,0.00057311,0.0005731,0.00057309,0.00057309,0.00057308,0.00057307,0.00057307,0.00057306,0.00057305,0.00057305,0.00057304,0.00057303,0.00057303,0.00057302,0.00057301,0.00057301,0.000573,0.00057299,0.00057299,0.00057298,0.00057297,0.00057297,0.00057296,0.00057295,0.00057295,0.00057294,0.00057293,0.00057293,0.00057292,0.00057291,0.00057291,0.0005729,0.00057289,0.00057289,0.00057288,0.00057287,0.00057287,0.00057286,0.00057285,0.00057285,0.00057284,0.00057283,0.00057283,0.00057282,0.00057281,0.00057281,0.0005728,0.00057279,0.00057279,0.00057278,0.00057277,0.00057277,0.00057276,0.00057275,0.00057275,0.00057274,0.00057274,0.00057273,0.00057272,0.00057272,0.00057271,0.0005727,0.0005727,0.00057269,0.00057268,0.00057268,0.00057267,0.00057266,0.00057266,0.00057265,0.00057264,0.00057264,0.00057263,0.00057262,0.00057262,0.00057261,0.00057261,0.0005726,0.00057259,0.00057259,0.00057258,0.00057257,0.00057257,0.00057256,0.00057255,0.00057255,0.00057254,0.00057253,0.00057253,0.00057252,0.00057252,0.00057251,0.0005725,0.0005725,0.00057249,0.00057248,0.00057248,0.00057247,0.00057246,0.00057246,0.00057245,0.00057244,0.00057244,0.00057243,0.00057243,0.00057242,0.00057241,0.00057241,0.0005724,0.00057239,0.00057239,0.00057238,0.00057237,0.00057237,0.00057236,0.00057236,0.00057235,0.00057234,0.00057234,0.00057233,0.00057232,0.00057232,0.00057231,0.00057231,0.0005723,0.00057229,0.00057229,0.00057228,0.00057227,0.00057227,0.00057226,0.00057226,0.00057225,0.00057224,0.00057224,0.00057223,0.00057222,0.00057222,0.00057221,0.00057221,0.0005722,0.00057219,0.00057219,0.00057218,0.00057217,0.00057217,0.00057216,0.00057216,0.00057215,0.00057214,0.00057214,0.00057213,0.00057212,0.00057212,0.00057211,0.00057211,0.0005721,0.00057209,0.00057209,0.00057208,0.00057208,0.00057207,0.00057206,0.00057206,0.00057205,0.00057204,0.00057204,0.00057203,0.00057203,0.00057202,0.00057201,0.00057201,0.000572,0.000572,0.00057199,0.00057198,0.00057198,0.00057197,0.00057196,0.00057196,0.00057195,0.00057195,0.00057194,0.00057193,0.00057193,0.00057192,0.00057192,0.00057191,0.0005719,0.0005719,0.00057189,0.00057189,0.00057188,0.00057187,0.00057187,0.00057186,0.00057186,0.00057185,0.00057184,0.00057184,0.00057183,0.00057183,0.00057182,0.00057181,0.00057181,0.0005718,0.0005718,0.00057179,0.00057178,0.00057178,0.00057177,0.00057177,0.00057176,0.00057175,0.00057175,0.00057174,0.00057174,0.00057173,0.00057172,0.00057172,0.00057171,0.00057171,0.0005717,0.00057169,0.00057169,0.00057168,0.00057168,0.00057167,0.00057166,0.00057166,0.00057165,0.00057165,0.00057164,0.00057163,0.00057163,0.00057162,0.00057162,0.00057161,0.0005716,0.0005716,0.00057159,0.00057159,0.00057158,0.00057157,0.00057157,0.00057156,0.00057156,0.00057155,0.00057155,0.00057154,0.00057153,0.00057153,0.00057152,0.00057152,0.00057151,0.0005715,0.0005715,0.00057149,0.00057149,0.00057148,0.00057148,0.00057147,0.00057146,0.00057146,0.00057145,0.00057145,0.00057144,0.00057143,0.00057143,0.00057142,0.00057142,0.00057141,0.00057141,0.0005714,0.00057139,0.00057139,0.00057138,0.00057138,0.00057137,0.00057136,0.00057136,0.00057135,0.00057135,0.00057134,0.00057134,0.00057133,0.00057132,0.00057132,0.00057131,0.00057131,0.0005713,0.0005713,0.00057129,0.00057128,0.00057128,0.00057127,0.00057127,0.00057126,0.00057126,0.00057125,0.00057124,0.00057124,0.00057123,0.00057123,0.00057122,0.00057122,0.00057121,0.0005712,0.0005712,0.00057119,0.00057119,0.00057118,0.00057118,0.00057117,0.00057116,0.00057116,0.00057115,0.00057115,0.00057114,0.00057114,0.00057113,0.00057112,0.00057112,0.00057111,0.00057111,0.0005711,0.0005711,0.00057109,0.00057109,0.00057108,0.00057107,0.00057107,0.00057106,0.00057106,0.00057105,0.00057105,0.00057104,0.00057103,0.00057103,0.00057102,0.00057102,0.00057101,0.00057101,0.000571,0.000571,0.00057099,0.00057098,0.00057098,0.00057097,0.00057097,0.00057096,0.00057096,0.00057095,0.00057095,0.00057094,0.00057093,0.00057093,0.00057092,0.00057092,0.00057091,0.00057091,0.0005709,0.0005709,0.00057089,0.00057088,0.00057088,0.00057087,0.00057087,0.00057086,0.00057086,0.00057085,0.00057085,0.00057084,0.00057084,0.00057083,0.00057082,0.00057082,0.00057081,0.00057081,0.0005708,0.0005708,0.00057079,0.00057079,0.00057078,0.00057077,0.00057077,0.00057076,0.00057076,0.00057075,0.00057075,0.00057074,0.00057074,0.00057073,0.00057073,0.00057072,0.00057072,0.00057071,0.0005707,0.0005707,0.00057069,0.00057069,0.00057068,0.00057068,0.00057067,0.00057067,0.00057066,0.00057066,0.00057065,0.00057064,0.00057064,0.00057063,0.00057063,0.00057062,0.00057062,0.00057061,0.00057061,0.0005706,0.0005706,0.00057059,0.00057059,0.00057058,0.00057057,0.00057057,0.00057056,0.00057056,0.00057055,0.00057055,0.00057054,0.00057054,0.00057053,0.00057053,0.00057052,0.00057052,0.00057051,0.00057051,0.0005705,0.00057049,0.00057049,0.00057048,0.00057048,0.00057047,0.00057047,0.00057046,0.00057046,0.00057045,0.00057045,0.00057044,0.00057044,0.00057043,0.00057043,0.00057042,0.00057042,0.00057041,0.0005704,0.0005704,0.00057039,0.00057039,0.00057038,0.00057038,0.00057037,0.00057037,0.00057036,0.00057036,0.00057035,0.00057035,0.00057034,0.00057034,0.00057033,0.00057033,0.00057032,0.00057032,0.00057031,0.0005703,0.0005703,0.00057029,0.00057029,0.00057028,0.00057028,0.00057027,0.00057027,0.00057026,0.00057026,0.00057025,0.00057025,0.00057024,0.00057024,0.00057023,0.00057023,0.00057022,0.00057022,0.00057021,0.00057021,0.0005702,0.0005702,0.00057019,0.00057019,0.00057018,0.00057018,0.00057017,0.00057016,0.00057016,0.00057015,0.00057015,0.00057014,0.00057014,0.00057013,0.00057013,0.00057012,0.00057012,0.00057011,0.00057011,0.0005701,0.0005701,0.00057009,0.00057009,0.00057008,0.00057008,0.00057007,0.00057007,0.00057006,0.00057006,0.00057005,0.00057005,0.00057004,0.00057004,0.00057003,0.00057003,0.00057002,0.00057002,0.00057001,0.00057001,0.00057,0.00057,0.00056999,0.00056999,0.00056998,0.00056998,0.00056997,0.00056997,0.00056996,0.00056996,0.00056995,0.00056995,0.00056994,0.00056994,0.00056993,0.00056993,0.00056992,0.00056992,0.00056991,0.00056991,0.0005699,0.0005699,0.00056989,0.00056989,0.00056988,0.00056988,0.00056987,0.00056987,0.00056986,0.00056986,0.00056985,0.00056985,0.00056984,0.00056984,0.00056983,0.00056983,0.00056982,0.00056982,0.00056981,0.00056981,0.0005698,0.0005698,0.00056979,0.00056979,0.00056978,0.00056978,0.00056977,0.00056977,0.00056976,0.00056976,0.00056975,0.00056975,0.00056974,0.00056974,0.00056973,0.00056973,0.00056972,0.00056972,0.00056971,0.00056971,0.0005697,0.0005697,0.00056969,0.00056969,0.00056968,0.00056968,0.00056967,0.00056967,0.00056966,0.00056966,0.00056965,0.00056965,0.00056964,0.00056964,0.00056963,0.00056963,0.00056962,0.00056962,0.00056961,0.00056961,0.0005696,0.0005696,0.00056959,0.00056959,0.00056958,0.00056958,0.00056957,0.00056957,0.00056957,0.00056956,0.00056956,0.00056955,0.00056955,0.00056954,0.00056954,0.00056953,0.00056953,0.00056952,0.00056952,0.00056951,0.00056951,0.0005695,0.0005695,0.00056949,0.00056949,0.00056948,0.00056948,0.00056947,0.00056947,0.00056946,0.00056946,0.00056945,0.00056945,0.00056944,0.00056944,0.00056944,0.00056943,0.00056943,0.00056942,0.00056942,0.00056941,0.00056941,0.0005694,0.0005694,0.00056939,0.00056939,0.00056938,0.00056938,0.00056937,0.00056937,0.00056936,0.00056936,0.00056935,0.00056935,0.00056934,0.00056934,0.00056934,0.00056933,0.00056933,0.00056932,0.00056932,0.00056931,0.00056931,0.0005693,0.0005693,0.00056929,0.00056929,0.00056928,0.00056928,0.00056927,0.00056927,0.00056926,0.00056926,0.00056925,0.00056925,0.00056925,0.00056924,0.00056924,0.00056923,0.00056923,0.00056922,0.00056922,0.00056921,0.00056921,0.0005692,0.0005692,0.00056919,0.00056919,0.00056918,0.00056918,0.00056918,0.00056917,0.00056917,0.00056916,0.00056916,0.00056915,0.00056915,0.00056914,0.00056914,0.00056913,0.00056913,0.00056912,0.00056912,0.00056911,0.00056911,0.00056911,0.0005691,0.0005691,0.00056909,0.00056909,0.00056908,0.00056908,0.00056907,0.00056907,0.00056906,0.00056906,0.00056905,0.00056905,0.00056905,0.00056904,0.00056904,0.00056903,0.00056903,0.00056902,0.00056902,0.00056901,0.00056901,0.000569,0.000569,0.000569,0.00056899,0.00056899,0.00056898,0.00056898,0.00056897,0.00056897,0.00056896,0.00056896,0.00056895,0.00056895,0.00056895,0.00056894,0.00056894,0.00056893,0.00056893,0.00056892,0.00056892,0.00056891,0.00056891,0.0005689,0.0005689,0.0005689,0.00056889,0.00056889,0.00056888,0.00056888,0.00056887,0.00056887,0.00056886,0.00056886,0.00056885,0.00056885,0.00056885,0.00056884,0.00056884,0.00056883,0.00056883,0.00056882,0.00056882,0.00056881,0.00056881,0.00056881,0.0005688,0.0005688,0.00056879,0.00056879,0.00056878,0.00056878,0.00056877,0.00056877,0.00056876,0.00056876,0.00056876,0.00056875,0.00056875,0.00056874,0.00056874,0.00056873,0.00056873,0.00056872,0.00056872,0.00056872,0.00056871,0.00056871,0.0005687,0.0005687,0.00056869,0.00056869,0.00056868,0.00056868,0.00056868,0.00056867,0.00056867,0.00056866,0.00056866,0.00056865,0.00056865,0.00056865,0.00056864,0.00056864,0.00056863,0.00056863,0.00056862,0.00056862,0.00056861,0.00056861,0.00056861,0.0005686,0.0005686,0.00056859,0.00056859,0.00056858,0.00056858,0.00056857,0.00056857,0.00056857,0.00056856,0.00056856,0.00056855,0.00056855,0.00056854,0.00056854,0.00056854,0.00056853,0.00056853,0.00056852,0.00056852,0.00056851,0.00056851,0.00056851,0.0005685,0.0005685,0.00056849,0.00056849,0.00056848,0.00056848,0.00056847,0.00056847,0.00056847,0.00056846,0.00056846,0.00056845,0.00056845,0.00056844,0.00056844,0.00056844,0.00056843,0.00056843,0.00056842,0.00056842,0.00056841,0.00056841,0.00056841,0.0005684,0.0005684,0.00056839,0.00056839,0.00056838,0.00056838,0.00056838,0.00056837,0.00056837,0.00056836,0.00056836,0.00056835,0.00056835,0.00056835,0.00056834,0.00056834,0.00056833,0.00056833,0.00056832,0.00056832,0.00056832,0.00056831,0.00056831,0.0005683,0.0005683,0.00056829,0.00056829,0.00056829,0.00056828,0.00056828,0.00056827,0.00056827,0.00056827,0.00056826,0.00056826,0.00056825,0.00056825,0.00056824,0.00056824,0.00056824,0.00056823,0.00056823,0.00056822,0.00056822,0.00056821,0.00056821,0.00056821,0.0005682,0.0005682,0.00056819,0.00056819,0.00056819,0.00056818,0.00056818,0.00056817,0.00056817,0.00056816,0.00056816,0.00056816,0.00056815,0.00056815,0.00056814,0.00056814,0.00056813,0.00056813,0.00056813,0.00056812,0.00056812,0.00056811,0.00056811,0.00056811,0.0005681,0.0005681,0.00056809,0.00056809,0.00056809,0.00056808,0.00056808,0.00056807,0.00056807,0.00056806,0.00056806,0.00056806,0.00056805,0.00056805,0.00056804,0.00056804,0.00056804,0.00056803,0.00056803,0.00056802,0.00056802,0.00056801,0.00056801,0.00056801,0.000568,0.000568,0.00056799,0.00056799,0.00056799,0.00056798,0.00056798,0.00056797,0.00056797,0.00056797,0.00056796,0.00056796,0.00056795,0.00056795,0.00056795,0.00056794,0.00056794,0.00056793,0.00056793,0.00056792,0.00056792,0.00056792,0.00056791,0.00056791,0.0005679,0.0005679,0.0005679,0.00056789,0.00056789,0.00056788,0.00056788,0.00056788,0.00056787,0.00056787,0.00056786,0.00056786,0.00056786,0.00056785,0.00056785,0.00056784,0.00056784,0.00056784,0.00056783,0.00056783,0.00056782,0.00056782,0.00056782,0.00056781,0.00056781,0.0005678,0.0005678,0.0005678,0.00056779,0.00056779,0.00056778,0.00056778,0.00056778,0.00056777,0.00056777,0.00056776,0.00056776,0.00056776,0.00056775,0.00056775,0.00056774,0.00056774,0.00056774,0.00056773,0.00056773,0.00056772,0.00056772,0.00056772,0.00056771,0.00056771,0.0005677,0.0005677,0.0005677,0.00056769,0.00056769,0.00056768,0.00056768,0.00056768,0.00056767,0.00056767,0.00056766,0.00056766,0.00056766,0.00056765,0.00056765,0.00056764,0.00056764,0.00056764,0.00056763,0.00056763,0.00056762,0.00056762,0.00056762,0.00056761,0.00056761,0.0005676,0.0005676,0.0005676,0.00056759,0.00056759,0.00056758,0.00056758,0.00056758,0.00056757,0.00056757,0.00056757,0.00056756,0.00056756,0.00056755,0.00056755,0.00056755,0.00056754,0.00056754,0.00056753,0.00056753,0.00056753,0.00056752,0.00056752,0.00056751,0.00056751,0.00056751,0.0005675,0.0005675,0.0005675,0.00056749,0.00056749,0.00056748,0.00056748,0.00056748,0.00056747,0.00056747,0.00056746,0.00056746,0.00056746,0.00056745,0.00056745,0.00056744,0.00056744,0.00056744,0.00056743,0.00056743,0.00056743,0.00056742,0.00056742,0.00056741,0.00056741,0.00056741,0.0005674,0.0005674,0.00056739,0.00056739,0.00056739,0.00056738,0.00056738,0.00056738,0.00056737,0.00056737,0.00056736,0.00056736,0.00056736,0.00056735,0.00056735,0.00056734,0.00056734,0.00056734,0.00056733,0.00056733,0.00056733,0.00056732,0.00056732,0.00056731,0.00056731,0.00056731,0.0005673,0.0005673,0.0005673,0.00056729,0.00056729,0.00056728,0.00056728,0.00056728,0.00056727,0.00056727,0.00056727,0.00056726,0.00056726,0.00056725,0.00056725,0.00056725,0.00056724,0.00056724,0.00056724,0.00056723,0.00056723,0.00056722,0.00056722,0.00056722,0.00056721,0.00056721,0.0005672,0.0005672,0.0005672,0.00056719,0.00056719,0.00056719,0.00056718,0.00056718,0.00056717,0.00056717,0.00056717,0.00056716,0.00056716,0.00056716,0.00056715,0.00056715,0.00056715,0.00056714,0.00056714,0.00056713,0.00056713,0.00056713,0.00056712,0.00056712,0.00056712,0.00056711,0.00056711,0.0005671,0.0005671,0.0005671,0.00056709,0.00056709,0.00056709,0.00056708,0.00056708,0.00056707,0.00056707,0.00056707,0.00056706,0.00056706,0.00056706,0.00056705,0.00056705,0.00056704,0.00056704,0.00056704,0.00056703,0.00056703,0.00056703,0.00056702,0.00056702,0.00056702,0.00056701,0.00056701,0.000567,0.000567,0.000567,0.00056699,0.00056699,0.00056699,0.00056698,0.00056698,0.00056698,0.00056697,0.00056697,0.00056696,0.00056696,0.00056696,0.00056695,0.00056695,0.00056695,0.00056694,0.00056694,0.00056694,0.00056693,0.00056693,0.00056692,0.00056692,0.00056692,0.00056691,0.00056691,0.00056691,0.0005669,0.0005669,0.0005669,0.00056689,0.00056689,0.00056688,0.00056688,0.00056688,0.00056687,0.00056687,0.00056687,0.00056686,0.00056686,0.00056686,0.00056685,0.00056685,0.00056684,0.00056684,0.00056684,0.00056683,0.00056683,0.00056683,0.00056682,0.00056682,0.00056682,0.00056681,0.00056681,0.0005668,0.0005668,0.0005668,0.00056679,0.00056679,0.00056679,0.00056678,0.00056678,0.00056678,0.00056677,0.00056677,0.00056677,0.00056676,0.00056676,0.00056675,0.00056675,0.00056675,0.00056674,0.00056674,0.00056674,0.00056673,0.00056673,0.00056673,0.00056672,0.00056672,0.00056672,0.00056671,0.00056671,0.00056671,0.0005667,0.0005667,0.00056669,0.00056669,0.00056669,0.00056668,0.00056668,0.00056668,0.00056667,0.00056667,0.00056667,0.00056666,0.00056666,0.00056666,0.00056665,0.00056665,0.00056665,0.00056664,0.00056664,0.00056663,0.00056663,0.00056663,0.00056662,0.00056662,0.00056662,0.00056661,0.00056661,0.00056661,0.0005666,0.0005666,0.0005666,0.00056659,0.00056659,0.00056659,0.00056658,0.00056658,0.00056658,0.00056657,0.00056657,0.00056656,0.00056656,0.00056656,0.00056655,0.00056655,0.00056655,0.00056654,0.00056654,0.00056654,0.00056653,0.00056653,0.00056653,0.00056652,0.00056652,0.00056652,0.00056651,0.00056651,0.00056651,0.0005665,0.0005665,0.0005665,0.00056649,0.00056649,0.00056649,0.00056648,0.00056648,0.00056647,0.00056647,0.00056647,0.00056646,0.00056646,0.00056646,0.00056645,0.00056645,0.00056645,0.00056644,0.00056644,0.00056644,0.00056643,0.00056643,0.00056643,0.00056642,0.00056642,0.00056642,0.00056641,0.00056641,0.00056641,0.0005664,0.0005664,0.0005664,0.00056639,0.00056639,0.00056639,0.00056638,0.00056638,0.00056638,0.00056637,0.00056637,0.00056637,0.00056636,0.00056636,0.00056635,0.00056635,0.00056635,0.00056634,0.00056634,0.00056634,0.00056633,0.00056633,0.00056633,0.00056632,0.00056632,0.00056632,0.00056631,0.00056631,0.00056631,0.0005663,0.0005663,0.0005663,0.00056629,0.00056629,0.00056629,0.00056628,0.00056628,0.00056628,0.00056627,0.00056627,0.00056627,0.00056626,0.00056626,0.00056626,0.00056625,0.00056625,0.00056625,0.00056624,0.00056624,0.00056624,0.00056623,0.00056623,0.00056623,0.00056622,0.00056622,0.00056622,0.00056621,0.00056621,0.00056621,0.0005662,0.0005662,0.0005662,0.00056619,0.00056619,0.00056619,0.00056618,0.00056618,0.00056618,0.00056617,0.00056617,0.00056617,0.00056616,0.00056616,0.00056616,0.00056615,0.00056615,0.00056615,0.00056614,0.00056614,0.00056614,0.00056613,0.00056613,0.00056613,0.00056612,0.00056612,0.00056612,0.00056611,0.00056611,0.00056611,0.0005661,0.0005661,0.0005661,0.00056609,0.00056609,0.00056609,0.00056608,0.00056608,0.00056608,0.00056607,0.00056607,0.00056607,0.00056606,0.00056606,0.00056606,0.00056605,0.00056605,0.00056605,0.00056605,0.00056604,0.00056604,0.00056604,0.00056603,0.00056603,0.00056603,0.00056602,0.00056602,0.00056602,0.00056601,0.00056601,0.00056601,0.000566,0.000566,0.000566,0.00056599,0.00056599,0.00056599,0.00056598,0.00056598,0.00056598,0.00056597,0.00056597,0.00056597,0.00056596,0.00056596,0.00056596,0.00056595,0.00056595,0.00056595,0.00056594,0.00056594,0.00056594,0.00056593,0.00056593,0.00056593,0.00056593,0.00056592,0.00056592,0.00056592,0.00056591,0.00056591,0.00056591,0.0005659,0.0005659,0.0005659,0.00056589,0.00056589,0.00056589,0.00056588,0.00056588,0.00056588,0.00056587,0.00056587,0.00056587,0.00056586,0.00056586,0.00056586,0.00056585,0.00056585,0.00056585,0.00056584,0.00056584,0.00056584,0.00056584,0.00056583,0.00056583,0.00056583,0.00056582,0.00056582,0.00056582,0.00056581,0.00056581,0.00056581,0.0005658,0.0005658,0.0005658,0.00056579,0.00056579,0.00056579,0.00056578,0.00056578,0.00056578,0.00056578,0.00056577,0.00056577,0.00056577,0.00056576,0.00056576,0.00056576,0.00056575,0.00056575,0.00056575,0.00056574,0.00056574,0.00056574,0.00056573,0.00056573,0.00056573,0.00056572,0.00056572,0.00056572,0.00056572,0.00056571,0.00056571,0.00056571,0.0005657,0.0005657,0.0005657,0.00056569,0.00056569,0.00056569,0.00056568,0.00056568,0.00056568,0.00056567,0.00056567,0.00056567,0.00056567,0.00056566,0.00056566,0.00056566,0.00056565,0.00056565,0.00056565,0.00056564,0.00056564,0.00056564,0.00056563,0.00056563,0.00056563,0.00056562,0.00056562,0.00056562,0.00056562,0.00056561,0.00056561,0.00056561,0.0005656,0.0005656,0.0005656,0.00056559,0.00056559,0.00056559,0.00056558,0.00056558,0.00056558,0.00056558,0.00056557,0.00056557,0.00056557,0.00056556,0.00056556,0.00056556,0.00056555,0.00056555,0.00056555,0.00056554,0.00056554,0.00056554,0.00056554,0.00056553,0.00056553,0.00056553,0.00056552,0.00056552,0.00056552,0.00056551,0.00056551,0.00056551,0.0005655,0.0005655,0.0005655,0.0005655,0.00056549,0.00056549,0.00056549,0.00056548,0.00056548,0.00056548,0.00056547,0.00056547,0.00056547,0.00056547,0.00056546,0.00056546,0.00056546,0.00056545,0.00056545,0.00056545,0.00056544,0.00056544,0.00056544,0.00056543,0.00056543,0.00056543,0.00056543,0.00056542,0.00056542,0.00056542,0.00056541,0.00056541,0.00056541,0.0005654,0.0005654,0.0005654,0.0005654,0.00056539,0.00056539,0.00056539,0.00056538,0.00056538,0.00056538,0.00056537,0.00056537,0.00056537,0.00056537,0.00056536,0.00056536,0.00056536,0.00056535,0.00056535,0.00056535,0.00056534,0.00056534,0.00056534,0.00056534,0.00056533,0.00056533,0.00056533,0.00056532,0.00056532,0.00056532,0.00056531,0.00056531,0.00056531,0.00056531,0.0005653,0.0005653,0.0005653,0.00056529,0.00056529,0.00056529,0.00056529,0.00056528,0.00056528,0.00056528,0.00056527,0.00056527,0.00056527,0.00056526,0.00056526,0.00056526,0.00056526,0.00056525,0.00056525,0.00056525,0.00056524,0.00056524,0.00056524,0.00056523,0.00056523,0.00056523,0.00056523,0.00056522,0.00056522,0.00056522,0.00056521,0.00056521,0.00056521,0.00056521,0.0005652,0.0005652,0.0005652,0.00056519,0.00056519,0.00056519,0.00056518,0.00056518,0.00056518,0.00056518,0.00056517,0.00056517,0.00056517,0.00056516,0.00056516,0.00056516,0.00056516,0.00056515,0.00056515,0.00056515,0.00056514,0.00056514,0.00056514,0.00056514,0.00056513,0.00056513,0.00056513,0.00056512,0.00056512,0.00056512,0.00056511,0.00056511,0.00056511,0.00056511,0.0005651,0.0005651,0.0005651,0.00056509,0.00056509,0.00056509,0.00056509,0.00056508,0.00056508,0.00056508,0.00056507,0.00056507,0.00056507,0.00056507,0.00056506,0.00056506,0.00056506,0.00056505,0.00056505,0.00056505,0.00056505,0.00056504,0.00056504,0.00056504,0.00056503,0.00056503,0.00056503,0.00056503,0.00056502,0.00056502,0.00056502,0.00056501,0.00056501,0.00056501,0.00056501,0.000565,0.000565,0.000565,0.00056499,0.00056499,0.00056499,0.00056499,0.00056498,0.00056498,0.00056498,0.00056497,0.00056497,0.00056497,0.00056497,0.00056496,0.00056496,0.00056496,0.00056495,0.00056495,0.00056495,0.00056495,0.00056494,0.00056494,0.00056494,0.00056493,0.00056493,0.00056493,0.00056493,0.00056492,0.00056492,0.00056492,0.00056491,0.00056491,0.00056491,0.00056491,0.0005649,0.0005649,0.0005649,0.00056489,0.00056489,0.00056489,0.00056489,0.00056488,0.00056488,0.00056488,0.00056487,0.00056487,0.00056487,0.00056487,0.00056486,0.00056486,0.00056486,0.00056486,0.00056485,0.00056485,0.00056485,0.00056484,0.00056484,0.00056484,0.00056484,0.00056483,0.00056483,0.00056483,0.00056482,0.00056482,0.00056482,0.00056482,0.00056481,0.00056481,0.00056481,0.0005648,0.0005648,0.0005648,0.0005648,0.00056479,0.00056479,0.00056479,0.00056479,0.00056478,0.00056478,0.00056478,0.00056477,0.00056477,0.00056477,0.00056477,0.00056476,0.00056476,0.00056476,0.00056476,0.00056475,0.00056475,0.00056475,0.00056474,0.00056474,0.00056474,0.00056474,0.00056473,0.00056473,0.00056473,0.00056472,0.00056472,0.00056472,0.00056472,0.00056471,0.00056471,0.00056471,0.00056471,0.0005647,0.0005647,0.0005647,0.00056469,0.00056469,0.00056469,0.00056469,0.00056468,0.00056468,0.00056468,0.00056468,0.00056467,0.00056467,0.00056467,0.00056466,0.00056466,0.00056466,0.00056466,0.00056465,0.00056465,0.00056465,0.00056465,0.00056464,0.00056464,0.00056464,0.00056463,0.00056463,0.00056463,0.00056463,0.00056462,0.00056462,0.00056462,0.00056462,0.00056461,0.00056461,0.00056461,0.0005646,0.0005646,0.0005646,0.0005646,0.00056459,0.00056459,0.00056459,0.00056459,0.00056458,0.00056458,0.00056458,0.00056457,0.00056457,0.00056457,0.00056457,0.00056456,0.00056456,0.00056456,0.00056456,0.00056455,0.00056455,0.00056455,0.00056455,0.00056454,0.00056454,0.00056454,0.00056453,0.00056453,0.00056453,0.00056453,0.00056452,0.00056452,0.00056452,0.00056452,0.00056451,0.00056451,0.00056451,0.0005645,0.0005645,0.0005645,0.0005645,0.00056449,0.00056449,0.00056449,0.00056449,0.00056448,0.00056448,0.00056448,0.00056448,0.00056447,0.00056447,0.00056447,0.00056446,0.00056446,0.00056446,0.00056446,0.00056445,0.00056445,0.00056445,0.00056445,0.00056444,0.00056444,0.00056444,0.00056444,0.00056443,0.00056443,0.00056443,0.00056443,0.00056442,0.00056442,0.00056442,0.00056441,0.00056441,0.00056441,0.00056441,0.0005644,0.0005644,0.0005644,0.0005644,0.00056439,0.00056439,0.00056439,0.00056439,0.00056438,0.00056438,0.00056438,0.00056437,0.00056437,0.00056437,0.00056437,0.00056436,0.00056436,0.00056436,0.00056436,0.00056435,0.00056435,0.00056435,0.00056435,0.00056434,0.00056434,0.00056434,0.00056434,0.00056433,0.00056433,0.00056433,0.00056433,0.00056432,0.00056432,0.00056432,0.00056431,0.00056431,0.00056431,0.00056431,0.0005643,0.0005643,0.0005643,0.0005643,0.00056429,0.00056429,0.00056429,0.00056429,0.00056428,0.00056428,0.00056428,0.00056428,0.00056427,0.00056427,0.00056427,0.00056427,0.00056426,0.00056426,0.00056426,0.00056426,0.00056425,0.00056425,0.00056425,0.00056424,0.00056424,0.00056424,0.00056424,0.00056423,0.00056423,0.00056423,0.00056423,0.00056422,0.00056422,0.00056422,0.00056422,0.00056421,0.00056421,0.00056421,0.00056421,0.0005642,0.0005642,0.0005642,0.0005642,0.00056419,0.00056419,0.00056419,0.00056419,0.00056418,0.00056418,0.00056418,0.00056418,0.00056417,0.00056417,0.00056417,0.00056417,0.00056416,0.00056416,0.00056416,0.00056416,0.00056415,0.00056415,0.00056415,0.00056414,0.00056414,0.00056414,0.00056414,0.00056413,0.00056413,0.00056413,0.00056413,0.00056412,0.00056412,0.00056412,0.00056412,0.00056411,0.00056411,0.00056411,0.00056411,0.0005641,0.0005641,0.0005641,0.0005641,0.00056409,0.00056409,0.00056409,0.00056409,0.00056408,0.00056408,0.00056408,0.00056408,0.00056407,0.00056407,0.00056407,0.00056407,0.00056406,0.00056406,0.00056406,0.00056406,0.00056405,0.00056405,0.00056405,0.00056405,0.00056404,0.00056404,0.00056404,0.00056404,0.00056403,0.00056403,0.00056403,0.00056403,0.00056402,0.00056402,0.00056402,0.00056402,0.00056401,0.00056401,0.00056401,0.00056401,0.000564,0.000564,0.000564,0.000564,0.00056399,0.00056399,0.00056399,0.00056399,0.00056398,0.00056398,0.00056398,0.00056398,0.00056397,0.00056397,0.00056397,0.00056397,0.00056396,0.00056396,0.00056396,0.00056396,0.00056395,0.00056395,0.00056395,0.00056395,0.00056394,0.00056394,0.00056394,0.00056394,0.00056393,0.00056393,0.00056393,0.00056393,0.00056392,0.00056392,0.00056392,0.00056392,0.00056391,0.00056391,0.00056391,0.00056391,0.0005639,0.0005639,0.0005639,0.0005639,0.0005639,0.00056389,0.00056389,0.00056389,0.00056389,0.00056388,0.00056388,0.00056388,0.00056388,0.00056387,0.00056387,0.00056387,0.00056387,0.00056386,0.00056386,0.00056386,0.00056386,0.00056385,0.00056385,0.00056385,0.00056385,0.00056384,0.00056384,0.00056384,0.00056384,0.00056383,0.00056383,0.00056383,0.00056383,0.00056382,0.00056382,0.00056382,0.00056382,0.00056381,0.00056381,0.00056381,0.00056381,0.0005638,0.0005638,0.0005638,0.0005638,0.0005638,0.00056379,0.00056379,0.00056379,0.00056379,0.00056378,0.00056378,0.00056378,0.00056378,0.00056377,0.00056377,0.00056377,0.00056377,0.00056376,0.00056376,0.00056376,0.00056376,0.00056375,0.00056375,0.00056375,0.00056375,0.00056374,0.00056374,0.00056374,0.00056374,0.00056373,0.00056373,0.00056373,0.00056373,0.00056373,0.00056372,0.00056372,0.00056372,0.00056372,0.00056371,0.00056371,0.00056371,0.00056371,0.0005637,0.0005637,0.0005637,0.0005637,0.00056369,0.00056369,0.00056369,0.00056369,0.00056368,0.00056368,0.00056368,0.00056368,0.00056368,0.00056367,0.00056367,0.00056367,0.00056367,0.00056366,0.00056366,0.00056366,0.00056366,0.00056365,0.00056365,0.00056365,0.00056365,0.00056364,0.00056364,0.00056364,0.00056364,0.00056363,0.00056363,0.00056363,0.00056363,0.00056363,0.00056362,0.00056362,0.00056362,0.00056362,0.00056361,0.00056361,0.00056361,0.00056361,0.0005636,0.0005636,0.0005636,0.0005636,0.00056359,0.00056359,0.00056359,0.00056359,0.00056359,0.00056358,0.00056358,0.00056358,0.00056358,0.00056357,0.00056357,0.00056357,0.00056357,0.00056356,0.00056356,0.00056356,0.00056356,0.00056356,0.00056355,0.00056355,0.00056355,0.00056355,0.00056354,0.00056354,0.00056354,0.00056354,0.00056353,0.00056353,0.00056353,0.00056353,0.00056352,0.00056352,0.00056352,0.00056352,0.00056352,0.00056351,0.00056351,0.00056351,0.00056351,0.0005635,0.0005635,0.0005635,0.0005635,0.00056349,0.00056349,0.00056349,0.00056349,0.00056349,0.00056348,0.00056348,0.00056348,0.00056348,0.00056347,0.00056347,0.00056347,0.00056347,0.00056346,0.00056346,0.00056346,0.00056346,0.00056346,0.00056345,0.00056345,0.00056345,0.00056345,0.00056344,0.00056344,0.00056344,0.00056344,0.00056343,0.00056343,0.00056343,0.00056343,0.00056343,0.00056342,0.00056342,0.00056342,0.00056342,0.00056341,0.00056341,0.00056341,0.00056341,0.0005634,0.0005634,0.0005634,0.0005634,0.0005634,0.00056339,0.00056339,0.00056339,0.00056339,0.00056338,0.00056338,0.00056338,0.00056338,0.00056338,0.00056337,0.00056337,0.00056337,0.00056337,0.00056336,0.00056336,0.00056336,0.00056336,0.00056335,0.00056335,0.00056335,0.00056335,0.00056335,0.00056334,0.00056334,0.00056334,0.00056334,0.00056333,0.00056333,0.00056333,0.00056333,0.00056333,0.00056332,0.00056332,0.00056332,0.00056332,0.00056331,0.00056331,0.00056331,0.00056331,0.00056331,0.0005633,0.0005633,0.0005633,0.0005633,0.00056329,0.00056329,0.00056329,0.00056329,0.00056328,0.00056328,0.00056328,0.00056328,0.00056328,0.00056327,0.00056327,0.00056327,0.00056327,0.00056326,0.00056326,0.00056326,0.00056326,0.00056326,0.00056325,0.00056325,0.00056325,0.00056325,0.00056324,0.00056324,0.00056324,0.00056324,0.00056324,0.00056323,0.00056323,0.00056323,0.00056323,0.00056322,0.00056322,0.00056322,0.00056322,0.00056322,0.00056321,0.00056321,0.00056321,0.00056321,0.0005632,0.0005632,0.0005632,0.0005632,0.0005632,0.00056319,0.00056319,0.00056319,0.00056319,0.00056318,0.00056318,0.00056318,0.00056318,0.00056318,0.00056317,0.00056317,0.00056317,0.00056317,0.00056316,0.00056316,0.00056316,0.00056316,0.00056316,0.00056315,0.00056315,0.00056315,0.00056315,0.00056314,0.00056314,0.00056314,0.00056314,0.00056314,0.00056313,0.00056313,0.00056313,0.00056313,0.00056313,0.00056312,0.00056312,0.00056312,0.00056312,0.00056311,0.00056311,0.00056311,0.00056311,0.00056311,0.0005631,0.0005631,0.0005631,0.0005631,0.00056309,0.00056309,0.00056309,0.00056309,0.00056309,0.00056308,0.00056308,0.00056308,0.00056308,0.00056307,0.00056307,0.00056307,0.00056307,0.00056307,0.00056306,0.00056306,0.00056306,0.00056306,0.00056306,0.00056305,0.00056305,0.00056305,0.00056305,0.00056304,0.00056304,0.00056304,0.00056304,0.00056304,0.00056303,0.00056303,0.00056303,0.00056303,0.00056303,0.00056302,0.00056302,0.00056302,0.00056302,0.00056301,0.00056301,0.00056301,0.00056301,0.00056301,0.000563,0.000563,0.000563,0.000563,0.00056299,0.00056299,0.00056299,0.00056299,0.00056299,0.00056298,0.00056298,0.00056298,0.00056298,0.00056298,0.00056297,0.00056297,0.00056297,0.00056297,0.00056296,0.00056296,0.00056296,0.00056296,0.00056296,0.00056295,0.00056295,0.00056295,0.00056295,0.00056295,0.00056294,0.00056294,0.00056294,0.00056294,0.00056294,0.00056293,0.00056293,0.00056293,0.00056293,0.00056292,0.00056292,0.00056292,0.00056292,0.00056292,0.00056291,0.00056291,0.00056291,0.00056291,0.00056291,0.0005629,0.0005629,0.0005629,0.0005629,0.00056289,0.00056289,0.00056289,0.00056289,0.00056289,0.00056288,0.00056288,0.00056288,0.00056288,0.00056288,0.00056287,0.00056287,0.00056287,0.00056287,0.00056287,0.00056286,0.00056286,0.00056286,0.00056286,0.00056285,0.00056285,0.00056285,0.00056285,0.00056285,0.00056284,0.00056284,0.00056284,0.00056284,0.00056284,0.00056283,0.00056283,0.00056283,0.00056283,0.00056283,0.00056282,0.00056282,0.00056282,0.00056282,0.00056281,0.00056281,0.00056281,0.00056281,0.00056281,0.0005628,0.0005628,0.0005628,0.0005628,0.0005628,0.00056279,0.00056279,0.00056279,0.00056279,0.00056279,0.00056278,0.00056278,0.00056278,0.00056278,0.00056278,0.00056277,0.00056277,0.00056277,0.00056277,0.00056276,0.00056276,0.00056276,0.00056276,0.00056276,0.00056275,0.00056275,0.00056275,0.00056275,0.00056275,0.00056274,0.00056274,0.00056274,0.00056274,0.00056274,0.00056273,0.00056273,0.00056273,0.00056273,0.00056273,0.00056272,0.00056272,0.00056272,0.00056272,0.00056272,0.00056271,0.00056271,0.00056271,0.00056271,0.00056271,0.0005627,0.0005627,0.0005627,0.0005627,0.00056269,0.00056269,0.00056269,0.00056269,0.00056269,0.00056268,0.00056268,0.00056268,0.00056268,0.00056268,0.00056267,0.00056267,0.00056267,0.00056267,0.00056267,0.00056266,0.00056266,0.00056266,0.00056266,0.00056266,0.00056265,0.00056265,0.00056265,0.00056265,0.00056265,0.00056264,0.00056264,0.00056264,0.00056264,0.00056264,0.00056263,0.00056263,0.00056263,0.00056263,0.00056263,0.00056262,0.00056262,0.00056262,0.00056262,0.00056262,0.00056261,0.00056261,0.00056261,0.00056261,0.00056261,0.0005626,0.0005626,0.0005626,0.0005626,0.0005626,0.00056259,0.00056259,0.00056259,0.00056259,0.00056259,0.00056258,0.00056258,0.00056258,0.00056258,0.00056257,0.00056257,0.00056257,0.00056257,0.00056257,0.00056256,0.00056256,0.00056256,0.00056256,0.00056256,0.00056255,0.00056255,0.00056255,0.00056255,0.00056255,0.00056254,0.00056254,0.00056254,0.00056254,0.00056254,0.00056253,0.00056253,0.00056253,0.00056253,0.00056253,0.00056252,0.00056252,0.00056252,0.00056252,0.00056252,0.00056251,0.00056251,0.00056251,0.00056251,0.00056251,0.0005625,0.0005625,0.0005625,0.0005625,0.0005625,0.0005625,0.00056249,0.00056249,0.00056249,0.00056249,0.00056249,0.00056248,0.00056248,0.00056248,0.00056248,0.00056248,0.00056247,0.00056247,0.00056247,0.00056247,0.00056247,0.00056246,0.00056246,0.00056246,0.00056246,0.00056246,0.00056245,0.00056245,0.00056245,0.00056245,0.00056245,0.00056244,0.00056244,0.00056244,0.00056244,0.00056244,0.00056243,0.00056243,0.00056243,0.00056243,0.00056243,0.00056242,0.00056242,0.00056242,0.00056242,0.00056242,0.00056241,0.00056241,0.00056241,0.00056241,0.00056241,0.0005624,0.0005624,0.0005624,0.0005624,0.0005624,0.00056239,0.00056239,0.00056239,0.00056239,0.00056239,0.00056238,0.00056238,0.00056238,0.00056238,0.00056238,0.00056237,0.00056237,0.00056237,0.00056237,0.00056237,0.00056237,0.00056236,0.00056236,0.00056236,0.00056236,0.00056236,0.00056235,0.00056235,0.00056235,0.00056235,0.00056235,0.00056234,0.00056234,0.00056234,0.00056234,0.00056234,0.00056233,0.00056233,0.00056233,0.00056233,0.00056233,0.00056232,0.00056232,0.00056232,0.00056232,0.00056232,0.00056231,0.00056231,0.00056231,0.00056231,0.00056231,0.00056231,0.0005623,0.0005623,0.0005623,0.0005623,0.0005623,0.00056229,0.00056229,0.00056229,0.00056229,0.00056229,0.00056228,0.00056228,0.00056228,0.00056228,0.00056228,0.00056227,0.00056227,0.00056227,0.00056227,0.00056227,0.00056226,0.00056226,0.00056226,0.00056226,0.00056226,0.00056226,0.00056225,0.00056225,0.00056225,0.00056225,0.00056225,0.00056224,0.00056224,0.00056224,0.00056224,0.00056224,0.00056223,0.00056223,0.00056223,0.00056223,0.00056223,0.00056222,0.00056222,0.00056222,0.00056222,0.00056222,0.00056222,0.00056221,0.00056221,0.00056221,0.00056221,0.00056221,0.0005622,0.0005622,0.0005622,0.0005622,0.0005622,0.00056219,0.00056219,0.00056219,0.00056219,0.00056219,0.00056219,0.00056218,0.00056218,0.00056218,0.00056218,0.00056218,0.00056217,0.00056217,0.00056217,0.00056217,0.00056217,0.00056216,0.00056216,0.00056216,0.00056216,0.00056216,0.00056215,0.00056215,0.00056215,0.00056215,0.00056215,0.00056215,0.00056214,0.00056214,0.00056214,0.00056214,0.00056214,0.00056213,0.00056213,0.00056213,0.00056213,0.00056213,0.00056212,0.00056212,0.00056212,0.00056212,0.00056212,0.00056212,0.00056211,0.00056211,0.00056211,0.00056211,0.00056211,0.0005621,0.0005621,0.0005621,0.0005621,0.0005621,0.00056209,0.00056209,0.00056209,0.00056209,0.00056209,0.00056209,0.00056208,0.00056208,0.00056208,0.00056208,0.00056208,0.00056207,0.00056207,0.00056207,0.00056207,0.00056207,0.00056207,0.00056206,0.00056206,0.00056206,0.00056206,0.00056206,0.00056205,0.00056205,0.00056205,0.00056205,0.00056205,0.00056204,0.00056204,0.00056204,0.00056204,0.00056204,0.00056204,0.00056203,0.00056203,0.00056203,0.00056203,0.00056203,0.00056202,0.00056202,0.00056202,0.00056202,0.00056202,0.00056202,0.00056201,0.00056201,0.00056201,0.00056201,0.00056201,0.000562,0.000562,0.000562,0.000562,0.000562,0.000562,0.00056199,0.00056199,0.00056199,0.00056199,0.00056199,0.00056198,0.00056198,0.00056198,0.00056198,0.00056198,0.00056198,0.00056197,0.00056197,0.00056197,0.00056197,0.00056197,0.00056196,0.00056196,0.00056196,0.00056196,0.00056196,0.00056196,0.00056195,0.00056195,0.00056195,0.00056195,0.00056195,0.00056194,0.00056194,0.00056194,0.00056194,0.00056194,0.00056194,0.00056193,0.00056193,0.00056193,0.00056193,0.00056193,0.00056192,0.00056192,0.00056192,0.00056192,0.00056192,0.00056192,0.00056191,0.00056191,0.00056191,0.00056191,0.00056191,0.0005619,0.0005619,0.0005619,0.0005619,0.0005619,0.0005619,0.00056189,0.00056189,0.00056189,0.00056189,0.00056189,0.00056188,0.00056188,0.00056188,0.00056188,0.00056188,0.00056188,0.00056187,0.00056187,0.00056187,0.00056187,0.00056187,0.00056186,0.00056186,0.00056186,0.00056186,0.00056186,0.00056186,0.00056185,0.00056185,0.00056185,0.00056185,0.00056185,0.00056185,0.00056184,0.00056184,0.00056184,0.00056184,0.00056184,0.00056183,0.00056183,0.00056183,0.00056183,0.00056183,0.00056183,0.00056182,0.00056182,0.00056182,0.00056182,0.00056182,0.00056181,0.00056181,0.00056181,0.00056181,0.00056181,0.00056181,0.0005618,0.0005618,0.0005618,0.0005618,0.0005618,0.0005618,0.00056179,0.00056179,0.00056179,0.00056179,0.00056179,0.00056178,0.00056178,0.00056178,0.00056178,0.00056178,0.00056178,0.00056177,0.00056177,0.00056177,0.00056177,0.00056177,0.00056177,0.00056176,0.00056176,0.00056176,0.00056176,0.00056176,0.00056175,0.00056175,0.00056175,0.00056175,0.00056175,0.00056175,0.00056174,0.00056174,0.00056174,0.00056174,0.00056174,0.00056174,0.00056173,0.00056173,0.00056173,0.00056173,0.00056173,0.00056172,0.00056172,0.00056172,0.00056172,0.00056172,0.00056172,0.00056171,0.00056171,0.00056171,0.00056171,0.00056171,0.00056171,0.0005617,0.0005617,0.0005617,0.0005617,0.0005617,0.0005617,0.00056169,0.00056169,0.00056169,0.00056169,0.00056169,0.00056168,0.00056168,0.00056168,0.00056168,0.00056168,0.00056168,0.00056167,0.00056167,0.00056167,0.00056167,0.00056167,0.00056167,0.00056166,0.00056166,0.00056166,0.00056166,0.00056166,0.00056166,0.00056165,0.00056165,0.00056165,0.00056165,0.00056165,0.00056164,0.00056164,0.00056164,0.00056164,0.00056164,0.00056164,0.00056163,0.00056163,0.00056163,0.00056163,0.00056163,0.00056163,0.00056162,0.00056162,0.00056162,0.00056162,0.00056162,0.00056162,0.00056161,0.00056161,0.00056161,0.00056161,0.00056161,0.00056161,0.0005616,0.0005616,0.0005616,0.0005616,0.0005616,0.0005616,0.00056159,0.00056159,0.00056159,0.00056159,0.00056159,0.00056158,0.00056158,0.00056158,0.00056158,0.00056158,0.00056158,0.00056157,0.00056157,0.00056157,0.00056157,0.00056157,0.00056157,0.00056156,0.00056156,0.00056156,0.00056156,0.00056156,0.00056156,0.00056155,0.00056155,0.00056155,0.00056155,0.00056155,0.00056155,0.00056154,0.00056154,0.00056154,0.00056154,0.00056154,0.00056154,0.00056153,0.00056153,0.00056153,0.00056153,0.00056153,0.00056153,0.00056152,0.00056152,0.00056152,0.00056152,0.00056152,0.00056152,0.00056151,0.00056151,0.00056151,0.00056151,0.00056151,0.00056151,0.0005615,0.0005615,0.0005615,0.0005615,0.0005615,0.0005615,0.00056149,0.00056149,0.00056149,0.00056149,0.00056149,0.00056148,0.00056148,0.00056148,0.00056148,0.00056148,0.00056148,0.00056147,0.00056147,0.00056147,0.00056147,0.00056147,0.00056147,0.00056146,0.00056146,0.00056146,0.00056146,0.00056146,0.00056146,0.00056145,0.00056145,0.00056145,0.00056145,0.00056145,0.00056145,0.00056144,0.00056144,0.00056144,0.00056144,0.00056144,0.00056144,0.00056143,0.00056143,0.00056143,0.00056143,0.00056143,0.00056143,0.00056142,0.00056142,0.00056142,0.00056142,0.00056142,0.00056142,0.00056141,0.00056141,0.00056141,0.00056141,0.00056141,0.00056141,0.0005614,0.0005614,0.0005614,0.0005614,0.0005614,0.0005614,0.00056139,0.00056139,0.00056139,0.00056139,0.00056139,0.00056139,0.00056139,0.00056138,0.00056138,0.00056138,0.00056138,0.00056138,0.00056138,0.00056137,0.00056137,0.00056137,0.00056137,0.00056137,0.00056137,0.00056136,0.00056136,0.00056136,0.00056136,0.00056136,0.00056136,0.00056135,0.00056135,0.00056135,0.00056135,0.00056135,0.00056135,0.00056134,0.00056134,0.00056134,0.00056134,0.00056134,0.00056134,0.00056133,0.00056133,0.00056133,0.00056133,0.00056133,0.00056133,0.00056132,0.00056132,0.00056132,0.00056132,0.00056132,0.00056132,0.00056131,0.00056131,0.00056131,0.00056131,0.00056131,0.00056131,0.0005613,0.0005613,0.0005613,0.0005613,0.0005613,0.0005613,0.00056129,0.00056129,0.00056129,0.00056129,0.00056129,0.00056129,0.00056129,0.00056128,0.00056128,0.00056128,0.00056128,0.00056128,0.00056128,0.00056127,0.00056127,0.00056127,0.00056127,0.00056127,0.00056127,0.00056126,0.00056126,0.00056126,0.00056126,0.00056126,0.00056126,0.00056125,0.00056125,0.00056125,0.00056125,0.00056125,0.00056125,0.00056124,0.00056124,0.00056124,0.00056124,0.00056124,0.00056124,0.00056124,0.00056123,0.00056123,0.00056123,0.00056123,0.00056123,0.00056123,0.00056122,0.00056122,0.00056122,0.00056122,0.00056122,0.00056122,0.00056121,0.00056121,0.00056121,0.00056121,0.00056121,0.00056121,0.0005612,0.0005612,0.0005612,0.0005612,0.0005612,0.0005612,0.0005612,0.00056119,0.00056119,0.00056119,0.00056119,0.00056119,0.00056119,0.00056118,0.00056118,0.00056118,0.00056118,0.00056118,0.00056118,0.00056117,0.00056117,0.00056117,0.00056117,0.00056117,0.00056117,0.00056116,0.00056116,0.00056116,0.00056116,0.00056116,0.00056116,0.00056116,0.00056115,0.00056115,0.00056115,0.00056115,0.00056115,0.00056115,0.00056114,0.00056114,0.00056114,0.00056114,0.00056114,0.00056114,0.00056113,0.00056113,0.00056113,0.00056113,0.00056113,0.00056113,0.00056113,0.00056112,0.00056112,0.00056112,0.00056112,0.00056112,0.00056112,0.00056111,0.00056111,0.00056111,0.00056111,0.00056111,0.00056111,0.0005611,0.0005611,0.0005611,0.0005611,0.0005611,0.0005611,0.0005611,0.00056109,0.00056109,0.00056109,0.00056109,0.00056109,0.00056109,0.00056108,0.00056108,0.00056108,0.00056108,0.00056108,0.00056108,0.00056108,0.00056107,0.00056107,0.00056107,0.00056107,0.00056107,0.00056107,0.00056106,0.00056106,0.00056106,0.00056106,0.00056106,0.00056106,0.00056105,0.00056105,0.00056105,0.00056105,0.00056105,0.00056105,0.00056105,0.00056104,0.00056104,0.00056104,0.00056104,0.00056104,0.00056104,0.00056103,0.00056103,0.00056103,0.00056103,0.00056103,0.00056103,0.00056103,0.00056102,0.00056102,0.00056102,0.00056102,0.00056102,0.00056102,0.00056101,0.00056101,0.00056101,0.00056101,0.00056101,0.00056101,0.00056101,0.000561,0.000561,0.000561,0.000561,0.000561,0.000561,0.00056099,0.00056099,0.00056099,0.00056099,0.00056099,0.00056099,0.00056099,0.00056098,0.00056098,0.00056098,0.00056098,0.00056098,0.00056098,0.00056097,0.00056097,0.00056097,0.00056097,0.00056097,0.00056097,0.00056097,0.00056096,0.00056096,0.00056096,0.00056096,0.00056096,0.00056096,0.00056095,0.00056095,0.00056095,0.00056095,0.00056095,0.00056095,0.00056095,0.00056094,0.00056094,0.00056094,0.00056094,0.00056094,0.00056094,0.00056093,0.00056093,0.00056093,0.00056093,0.00056093,0.00056093,0.00056093,0.00056092,0.00056092,0.00056092,0.00056092,0.00056092,0.00056092,0.00056092,0.00056091,0.00056091,0.00056091,0.00056091,0.00056091,0.00056091,0.0005609,0.0005609,0.0005609,0.0005609,0.0005609,0.0005609,0.0005609,0.00056089,0.00056089,0.00056089,0.00056089,0.00056089,0.00056089,0.00056088,0.00056088,0.00056088,0.00056088,0.00056088,0.00056088,0.00056088,0.00056087,0.00056087,0.00056087,0.00056087,0.00056087,0.00056087,0.00056087,0.00056086,0.00056086,0.00056086,0.00056086,0.00056086,0.00056086,0.00056085,0.00056085,0.00056085,0.00056085,0.00056085,0.00056085,0.00056085,0.00056084,0.00056084,0.00056084,0.00056084,0.00056084,0.00056084,0.00056084,0.00056083,0.00056083,0.00056083,0.00056083,0.00056083,0.00056083,0.00056082,0.00056082,0.00056082,0.00056082,0.00056082,0.00056082,0.00056082,0.00056081,0.00056081,0.00056081,0.00056081,0.00056081,0.00056081,0.00056081,0.0005608,0.0005608,0.0005608,0.0005608,0.0005608,0.0005608,0.00056079,0.00056079,0.00056079,0.00056079,0.00056079,0.00056079,0.00056079,0.00056078,0.00056078,0.00056078,0.00056078,0.00056078,0.00056078,0.00056078,0.00056077,0.00056077,0.00056077,0.00056077,0.00056077,0.00056077,0.00056077,0.00056076,0.00056076,0.00056076,0.00056076,0.00056076,0.00056076,0.00056076,0.00056075,0.00056075,0.00056075,0.00056075,0.00056075,0.00056075,0.00056074,0.00056074,0.00056074,0.00056074,0.00056074,0.00056074,0.00056074,0.00056073,0.00056073,0.00056073,0.00056073,0.00056073,0.00056073,0.00056073,0.00056072,0.00056072,0.00056072,0.00056072,0.00056072,0.00056072,0.00056072,0.00056071,0.00056071,0.00056071,0.00056071,0.00056071,0.00056071,0.00056071,0.0005607,0.0005607,0.0005607,0.0005607,0.0005607,0.0005607,0.00056069,0.00056069,0.00056069,0.00056069,0.00056069,0.00056069,0.00056069,0.00056068,0.00056068,0.00056068,0.00056068,0.00056068,0.00056068,0.00056068,0.00056067,0.00056067,0.00056067,0.00056067,0.00056067,0.00056067,0.00056067,0.00056066,0.00056066,0.00056066,0.00056066,0.00056066,0.00056066,0.00056066,0.00056065,0.00056065,0.00056065,0.00056065,0.00056065,0.00056065,0.00056065,0.00056064,0.00056064,0.00056064,0.00056064,0.00056064,0.00056064,0.00056064,0.00056063,0.00056063,0.00056063,0.00056063,0.00056063,0.00056063,0.00056063,0.00056062,0.00056062,0.00056062,0.00056062,0.00056062,0.00056062,0.00056062,0.00056061,0.00056061,0.00056061,0.00056061,0.00056061,0.00056061,0.00056061,0.0005606,0.0005606,0.0005606,0.0005606,0.0005606,0.0005606,0.0005606,0.00056059,0.00056059,0.00056059,0.00056059,0.00056059,0.00056059,0.00056059,0.00056058,0.00056058,0.00056058,0.00056058,0.00056058,0.00056058,0.00056058,0.00056057,0.00056057,0.00056057,0.00056057,0.00056057,0.00056057,0.00056057,0.00056056,0.00056056,0.00056056,0.00056056,0.00056056,0.00056056,0.00056056,0.00056055,0.00056055,0.00056055,0.00056055,0.00056055,0.00056055,0.00056055,0.00056054,0.00056054,0.00056054,0.00056054,0.00056054,0.00056054,0.00056054,0.00056053,0.00056053,0.00056053,0.00056053,0.00056053,0.00056053,0.00056053,0.00056052,0.00056052,0.00056052,0.00056052,0.00056052,0.00056052,0.00056052,0.00056051,0.00056051,0.00056051,0.00056051,0.00056051,0.00056051,0.00056051,0.0005605,0.0005605,0.0005605,0.0005605,0.0005605,0.0005605,0.0005605,0.00056049,0.00056049,0.00056049,0.00056049,0.00056049,0.00056049,0.00056049,0.00056048,0.00056048,0.00056048,0.00056048,0.00056048,0.00056048,0.00056048,0.00056048,0.00056047,0.00056047,0.00056047,0.00056047,0.00056047,0.00056047,0.00056047,0.00056046,0.00056046,0.00056046,0.00056046,0.00056046,0.00056046,0.00056046,0.00056045,0.00056045,0.00056045,0.00056045,0.00056045,0.00056045,0.00056045,0.00056044,0.00056044,0.00056044,0.00056044,0.00056044,0.00056044,0.00056044,0.00056043,0.00056043,0.00056043,0.00056043,0.00056043,0.00056043,0.00056043,0.00056043,0.00056042,0.00056042,0.00056042,0.00056042,0.00056042,0.00056042,0.00056042,0.00056041,0.00056041,0.00056041,0.00056041,0.00056041,0.00056041,0.00056041,0.0005604,0.0005604,0.0005604,0.0005604,0.0005604,0.0005604,0.0005604,0.00056039,0.00056039,0.00056039,0.00056039,0.00056039,0.00056039,0.00056039,0.00056039,0.00056038,0.00056038,0.00056038,0.00056038,0.00056038,0.00056038,0.00056038,0.00056037,0.00056037,0.00056037,0.00056037,0.00056037,0.00056037,0.00056037,0.00056036,0.00056036,0.00056036,0.00056036,0.00056036,0.00056036,0.00056036,0.00056035,0.00056035,0.00056035,0.00056035,0.00056035,0.00056035,0.00056035,0.00056035,0.00056034,0.00056034,0.00056034,0.00056034,0.00056034,0.00056034,0.00056034,0.00056033,0.00056033,0.00056033,0.00056033,0.00056033,0.00056033,0.00056033,0.00056032,0.00056032,0.00056032,0.00056032,0.00056032,0.00056032,0.00056032,0.00056032,0.00056031,0.00056031,0.00056031,0.00056031,0.00056031,0.00056031,0.00056031,0.0005603,0.0005603,0.0005603,0.0005603,0.0005603,0.0005603,0.0005603,0.0005603,0.00056029,0.00056029,0.00056029,0.00056029,0.00056029,0.00056029,0.00056029,0.00056028,0.00056028,0.00056028,0.00056028,0.00056028,0.00056028,0.00056028,0.00056027,0.00056027,0.00056027,0.00056027,0.00056027,0.00056027,0.00056027,0.00056027,0.00056026,0.00056026,0.00056026,0.00056026,0.00056026,0.00056026,0.00056026,0.00056025,0.00056025,0.00056025,0.00056025,0.00056025,0.00056025,0.00056025,0.00056025,0.00056024,0.00056024,0.00056024,0.00056024,0.00056024,0.00056024,0.00056024,0.00056023,0.00056023,0.00056023,0.00056023,0.00056023,0.00056023,0.00056023,0.00056023,0.00056022,0.00056022,0.00056022,0.00056022,0.00056022,0.00056022,0.00056022,0.00056021,0.00056021,0.00056021,0.00056021,0.00056021,0.00056021,0.00056021,0.00056021,0.0005602,0.0005602,0.0005602,0.0005602,0.0005602,0.0005602,0.0005602,0.00056019,0.00056019,0.00056019,0.00056019,0.00056019,0.00056019,0.00056019,0.00056019,0.00056018,0.00056018,0.00056018,0.00056018,0.00056018,0.00056018,0.00056018,0.00056018,0.00056017,0.00056017,0.00056017,0.00056017,0.00056017,0.00056017,0.00056017,0.00056016,0.00056016,0.00056016,0.00056016,0.00056016,0.00056016,0.00056016,0.00056016,0.00056015,0.00056015,0.00056015,0.00056015,0.00056015,0.00056015,0.00056015,0.00056014,0.00056014,0.00056014,0.00056014,0.00056014,0.00056014,0.00056014,0.00056014,0.00056013,0.00056013,0.00056013,0.00056013,0.00056013,0.00056013,0.00056013,0.00056013,0.00056012,0.00056012,0.00056012,0.00056012,0.00056012,0.00056012,0.00056012,0.00056011,0.00056011,0.00056011,0.00056011,0.00056011,0.00056011,0.00056011,0.00056011,0.0005601,0.0005601,0.0005601,0.0005601,0.0005601,0.0005601,0.0005601,0.0005601,0.00056009,0.00056009,0.00056009,0.00056009,0.00056009,0.00056009,0.00056009,0.00056008,0.00056008,0.00056008,0.00056008,0.00056008,0.00056008,0.00056008,0.00056008,0.00056007,0.00056007,0.00056007,0.00056007,0.00056007,0.00056007,0.00056007,0.00056007,0.00056006,0.00056006,0.00056006,0.00056006,0.00056006,0.00056006,0.00056006,0.00056006,0.00056005,0.00056005,0.00056005,0.00056005,0.00056005,0.00056005,0.00056005,0.00056004,0.00056004,0.00056004,0.00056004,0.00056004,0.00056004,0.00056004,0.00056004,0.00056003,0.00056003,0.00056003,0.00056003,0.00056003,0.00056003,0.00056003,0.00056003,0.00056002,0.00056002,0.00056002,0.00056002,0.00056002,0.00056002,0.00056002,0.00056002,0.00056001,0.00056001,0.00056001,0.00056001,0.00056001,0.00056001,0.00056001,0.00056001,0.00056,0.00056,0.00056,0.00056,0.00056,0.00056,0.00056,0.00055999,0.00055999,0.00055999,0.00055999,0.00055999,0.00055999,0.00055999,0.00055999,0.00055998,0.00055998,0.00055998,0.00055998,0.00055998,0.00055998,0.00055998,0.00055998,0.00055997,0.00055997,0.00055997,0.00055997,0.00055997,0.00055997,0.00055997,0.00055997,0.00055996,0.00055996,0.00055996,0.00055996,0.00055996,0.00055996,0.00055996,0.00055996,0.00055995,0.00055995,0.00055995,0.00055995,0.00055995,0.00055995,0.00055995,0.00055995,0.00055994,0.00055994,0.00055994,0.00055994,0.00055994,0.00055994,0.00055994,0.00055994,0.00055993,0.00055993,0.00055993,0.00055993,0.00055993,0.00055993,0.00055993,0.00055993,0.00055992,0.00055992,0.00055992,0.00055992,0.00055992,0.00055992,0.00055992,0.00055992,0.00055991,0.00055991,0.00055991,0.00055991,0.00055991,0.00055991,0.00055991,0.00055991,0.0005599,0.0005599,0.0005599,0.0005599,0.0005599,0.0005599,0.0005599,0.0005599,0.00055989,0.00055989,0.00055989,0.00055989,0.00055989,0.00055989,0.00055989,0.00055989,0.00055988,0.00055988,0.00055988,0.00055988,0.00055988,0.00055988,0.00055988,0.00055988,0.00055987,0.00055987,0.00055987,0.00055987,0.00055987,0.00055987,0.00055987,0.00055987,0.00055986,0.00055986,0.00055986,0.00055986,0.00055986,0.00055986,0.00055986,0.00055986,0.00055985,0.00055985,0.00055985,0.00055985,0.00055985,0.00055985,0.00055985,0.00055985,0.00055984,0.00055984,0.00055984,0.00055984,0.00055984,0.00055984,0.00055984,0.00055984,0.00055983,0.00055983,0.00055983,0.00055983,0.00055983,0.00055983,0.00055983,0.00055983,0.00055982,0.00055982,0.00055982,0.00055982,0.00055982,0.00055982,0.00055982,0.00055982,0.00055981,0.00055981,0.00055981,0.00055981,0.00055981,0.00055981,0.00055981,0.00055981,0.00055981,0.0005598,0.0005598,0.0005598,0.0005598,0.0005598,0.0005598,0.0005598,0.0005598,0.00055979,0.00055979,0.00055979,0.00055979,0.00055979,0.00055979,0.00055979,0.00055979,0.00055978,0.00055978,0.00055978,0.00055978,0.00055978,0.00055978,0.00055978,0.00055978,0.00055977,0.00055977,0.00055977,0.00055977,0.00055977,0.00055977,0.00055977,0.00055977,0.00055976,0.00055976,0.00055976,0.00055976,0.00055976,0.00055976,0.00055976,0.00055976,0.00055976,0.00055975,0.00055975,0.00055975,0.00055975,0.00055975,0.00055975,0.00055975,0.00055975,0.00055974,0.00055974,0.00055974,0.00055974,0.00055974,0.00055974,0.00055974,0.00055974,0.00055973,0.00055973,0.00055973,0.00055973,0.00055973,0.00055973,0.00055973,0.00055973,0.00055972,0.00055972,0.00055972,0.00055972,0.00055972,0.00055972,0.00055972,0.00055972,0.00055972,0.00055971,0.00055971,0.00055971,0.00055971,0.00055971,0.00055971,0.00055971,0.00055971,0.0005597,0.0005597,0.0005597,0.0005597,0.0005597,0.0005597,0.0005597,0.0005597,0.00055969,0.00055969,0.00055969,0.00055969,0.00055969,0.00055969,0.00055969,0.00055969,0.00055969,0.00055968,0.00055968,0.00055968,0.00055968,0.00055968,0.00055968,0.00055968,0.00055968,0.00055967,0.00055967,0.00055967,0.00055967,0.00055967,0.00055967,0.00055967,0.00055967,0.00055966,0.00055966,0.00055966,0.00055966,0.00055966,0.00055966,0.00055966,0.00055966,0.00055966,0.00055965,0.00055965,0.00055965,0.00055965,0.00055965,0.00055965,0.00055965,0.00055965,0.00055964,0.00055964,0.00055964,0.00055964,0.00055964,0.00055964,0.00055964,0.00055964,0.00055964,0.00055963,0.00055963,0.00055963,0.00055963,0.00055963,0.00055963,0.00055963,0.00055963,0.00055962,0.00055962,0.00055962,0.00055962,0.00055962,0.00055962,0.00055962,0.00055962,0.00055962,0.00055961,0.00055961,0.00055961,0.00055961,0.00055961,0.00055961,0.00055961,0.00055961,0.0005596,0.0005596,0.0005596,0.0005596,0.0005596,0.0005596,0.0005596,0.0005596,0.0005596,0.00055959,0.00055959,0.00055959,0.00055959,0.00055959,0.00055959,0.00055959,0.00055959,0.00055958,0.00055958,0.00055958,0.00055958,0.00055958,0.00055958,0.00055958,0.00055958,0.00055958,0.00055957,0.00055957,0.00055957,0.00055957,0.00055957,0.00055957,0.00055957,0.00055957,0.00055956,0.00055956,0.00055956,0.00055956,0.00055956,0.00055956,0.00055956,0.00055956,0.00055956,0.00055955,0.00055955,0.00055955,0.00055955,0.00055955,0.00055955,0.00055955,0.00055955,0.00055955,0.00055954,0.00055954,0.00055954,0.00055954,0.00055954,0.00055954,0.00055954,0.00055954,0.00055953,0.00055953,0.00055953,0.00055953,0.00055953,0.00055953,0.00055953,0.00055953,0.00055953,0.00055952,0.00055952,0.00055952,0.00055952,0.00055952,0.00055952,0.00055952,0.00055952,0.00055951,0.00055951,0.00055951,0.00055951,0.00055951,0.00055951,0.00055951,0.00055951,0.00055951,0.0005595,0.0005595,0.0005595,0.0005595,0.0005595,0.0005595,0.0005595,0.0005595,0.0005595,0.00055949,0.00055949,0.00055949,0.00055949,0.00055949,0.00055949,0.00055949,0.00055949,0.00055949,0.00055948,0.00055948,0.00055948,0.00055948,0.00055948,0.00055948,0.00055948,0.00055948,0.00055947,0.00055947,0.00055947,0.00055947,0.00055947,0.00055947,0.00055947,0.00055947,0.00055947,0.00055946,0.00055946,0.00055946,0.00055946,0.00055946,0.00055946,0.00055946,0.00055946,0.00055946,0.00055945,0.00055945,0.00055945,0.00055945,0.00055945,0.00055945,0.00055945,0.00055945,0.00055945,0.00055944,0.00055944,0.00055944,0.00055944,0.00055944,0.00055944,0.00055944,0.00055944,0.00055943,0.00055943,0.00055943,0.00055943,0.00055943,0.00055943,0.00055943,0.00055943,0.00055943,0.00055942,0.00055942,0.00055942,0.00055942,0.00055942,0.00055942,0.00055942,0.00055942,0.00055942,0.00055941,0.00055941,0.00055941,0.00055941,0.00055941,0.00055941,0.00055941,0.00055941,0.00055941,0.0005594,0.0005594,0.0005594,0.0005594,0.0005594,0.0005594,0.0005594,0.0005594,0.0005594,0.00055939,0.00055939,0.00055939,0.00055939,0.00055939,0.00055939,0.00055939,0.00055939,0.00055939,0.00055938,0.00055938,0.00055938,0.00055938,0.00055938,0.00055938,0.00055938,0.00055938,0.00055938,0.00055937,0.00055937,0.00055937,0.00055937,0.00055937,0.00055937,0.00055937,0.00055937,0.00055936,0.00055936,0.00055936,0.00055936,0.00055936,0.00055936,0.00055936,0.00055936,0.00055936,0.00055935,0.00055935,0.00055935,0.00055935,0.00055935,0.00055935,0.00055935,0.00055935,0.00055935,0.00055934,0.00055934,0.00055934,0.00055934,0.00055934,0.00055934,0.00055934,0.00055934,0.00055934,0.00055933,0.00055933,0.00055933,0.00055933,0.00055933,0.00055933,0.00055933,0.00055933,0.00055933,0.00055932,0.00055932,0.00055932,0.00055932,0.00055932,0.00055932,0.00055932,0.00055932,0.00055932,0.00055931,0.00055931,0.00055931,0.00055931,0.00055931,0.00055931,0.00055931,0.00055931,0.00055931,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.0005593,0.00055929,0.00055929,0.00055929,0.00055929,0.00055929,0.00055929,0.00055929,0.00055929,0.00055929,0.00055928,0.00055928,0.00055928,0.00055928,0.00055928,0.00055928,0.00055928,0.00055928,0.00055928,0.00055927,0.00055927,0.00055927,0.00055927,0.00055927,0.00055927,0.00055927,0.00055927,0.00055927,0.00055926,0.00055926,0.00055926,0.00055926,0.00055926,0.00055926,0.00055926,0.00055926,0.00055926,0.00055925,0.00055925,0.00055925,0.00055925,0.00055925,0.00055925,0.00055925,0.00055925,0.00055925,0.00055924,0.00055924,0.00055924,0.00055924,0.00055924,0.00055924,0.00055924,0.00055924,0.00055924,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055923,0.00055922,0.00055922,0.00055922,0.00055922,0.00055922,0.00055922,0.00055922,0.00055922,0.00055922,0.00055921,0.00055921,0.00055921,0.00055921,0.00055921,0.00055921,0.00055921,0.00055921,0.00055921,0.0005592,0.0005592,0.0005592,0.0005592,0.0005592,0.0005592,0.0005592,0.0005592,0.0005592,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055919,0.00055918,0.00055918,0.00055918,0.00055918,0.00055918,0.00055918,0.00055918,0.00055918,0.00055918,0.00055917,0.00055917,0.00055917,0.00055917,0.00055917,0.00055917,0.00055917,0.00055917,0.00055917,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055916,0.00055915,0.00055915,0.00055915,0.00055915,0.00055915,0.00055915,0.00055915,0.00055915,0.00055915,0.00055914,0.00055914,0.00055914,0.00055914,0.00055914,0.00055914,0.00055914,0.00055914,0.00055914,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055913,0.00055912,0.00055912,0.00055912,0.00055912,0.00055912,0.00055912,0.00055912,0.00055912,0.00055912,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.00055911,0.0005591,0.0005591,0.0005591,0.0005591,0.0005591,0.0005591,0.0005591,0.0005591,0.0005591,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055909,0.00055908,0.00055908,0.00055908,0.00055908,0.00055908,0.00055908,0.00055908,0.00055908,0.00055908,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055907,0.00055906,0.00055906,0.00055906,0.00055906,0.00055906,0.00055906,0.00055906,0.00055906,0.00055906,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055905,0.00055904,0.00055904,0.00055904,0.00055904,0.00055904,0.00055904,0.00055904,0.00055904,0.00055904,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055903,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055902,0.00055901,0.00055901,0.00055901,0.00055901,0.00055901,0.00055901,0.00055901,0.00055901,0.00055901,0.000559,0.000559,0.000559,0.000559,0.000559,0.000559,0.000559,0.000559,0.000559,0.000559,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055899,0.00055898,0.00055898,0.00055898,0.00055898,0.00055898,0.00055898,0.00055898,0.00055898,0.00055898,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055897,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055896,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055895,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055894,0.00055893,0.00055893,0.00055893,0.00055893,0.00055893,0.00055893,0.00055893,0.00055893,0.00055893,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055892,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.00055891,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.0005589,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055889,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055888,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055887,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055886,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055885,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055884,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055883,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055882,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.00055881,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.0005588,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055879,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055878,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055877,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055876,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055875,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055874,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055873,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055872,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.00055871,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.0005587,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055869,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055868,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055867,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055866,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055865,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055864,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055863,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055862,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.00055861,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.0005586,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055859,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055858,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055857,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055856,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055855,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055854,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055853,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055852,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.00055851,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.0005585,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055849,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055848,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055847,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055846,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055845,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055844,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055843,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055842,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.00055841,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.0005584,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055839,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055838,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055837,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055836,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055835,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055834,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055833,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055832,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.00055831,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.0005583,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055829,0.00055828,0.00055828,0.00055828,0.00055828,0.00055828,0.00055828,0.00055828,0.00055828
-	}};
+	// Shared diode nonlinearity (see LookupTables.hpp)
+	const LookupTables::DiodeKernel* diode = &LookupTables::diodeKernel();
 
 	// Constants from circuit components
 	const float alpha = 0.405246f;
@@ -54,6 +57,46 @@ private:
     float half_T_wc_alpha = half_T_wc * alpha;
     float half_T_wc_beta = half_T_wc * beta;
 
+	Newton::Solver<float, 2> newton;
+
+	// Residual and Jacobian of the trapezoidal discretization, for Newton::Solver
+	struct Equations {
+		const MS20Filter& f;
+		const float Vin;
+		float tanh_a1_n = 0.0f;
+		float tanh_a2_n = 0.0f;
+
+		Equations(const MS20Filter& f, float Vin) : f(f), Vin(Vin) {}
+
+		inline void evaluate(const float (&V)[2], float (&F)[2], float (&J)[2][2], int i, bool active) {
+			// Diode feedback and its derivative w.r.t. V[1]
+			float dxFeedbackNL_n;
+			const float feedbackNL_n = f.diode->process(std::abs(f.k*V[1]), dxFeedbackNL_n);
+			float kdFeedback = f.k*dxFeedbackNL_n*f.signum(f.k*V[1]);
+
+			// Damp the Jacobian near the fold of the resonance loop (see MS20FilterSIMD)
+			if (i >= fullNewtonSteps && kdFeedback > 0.0f)
+				kdFeedback = 0.0f;
+
+			const float a1_n = f.alpha*(Vin - V[0] - feedbackNL_n);
+			const float a2_n = f.beta*(V[0] - V[1] + feedbackNL_n);
+
+			tanh_a1_n = std::tanh(a1_n);
+			tanh_a2_n = std::tanh(a2_n);
+			const float sech2_a1 = 1.0f - tanh_a1_n*tanh_a1_n;
+			const float sech2_a2 = 1.0f - tanh_a2_n*tanh_a2_n;
+
+			F[0] = V[0] - f.V_n1[0] - f.half_T_wc*(tanh_a1_n + f.tanh_a1_n1);
+			F[1] = V[1] - f.V_n1[1] - f.half_T_wc*(tanh_a2_n + f.tanh_a2_n1);
+
+			// Jacobian matrix
+			J[0][0] = 1.0f + f.half_T_wc_alpha*sech2_a1;
+			J[0][1] = f.half_T_wc_alpha*sech2_a1*kdFeedback;
+			J[1][0] = -f.half_T_wc_beta*sech2_a2;
+			J[1][1] = 1.0f - f.half_T_wc_beta*sech2_a2*(kdFeedback - 1.0f);
+		}
+	};
+
 public: 
 	MS20Filter() {}
 	MS20Filter(float SR) {
@@ -78,14 +121,6 @@ public:
 		return (x > 0.0f) ? 1.0f : ((x < 0.0f) ? -1.0f : 0.0f);
 	}
 
-	inline float fx(float x) const noexcept {
-		return signum(x)*diodeDrop[int (x)];
-	}
-	
-	inline float dfx(float x) const noexcept {
-		return diodeDropDx[int (x)];
-	}
-
     void setParams(float fc, float resonance) {
         k = resonance;
 
@@ -99,65 +134,16 @@ public:
     }
 
 	void process(float Vin) {
-        float tanh_a1_n, tanh_a2_n;
-
-		for (int i=0; i<10; i++) {
-            float input = floor(std::abs(k*V_n[1]) * 1000.0f);
-			float feedbackNL_n = fx(input);
-			float dxFeedbackNL_n = dfx(input);
-
-			float a1_n = alpha*(Vin - V_n[0] - feedbackNL_n);
-			float a2_n = beta*(V_n[0] - V_n[1] + feedbackNL_n);
-
-            tanh_a1_n = std::tanh(a1_n);
-            tanh_a2_n = std::tanh(a2_n);
-            const float tanh_a1_n_2 = tanh_a1_n * tanh_a1_n;
-            const float tanh_a2_n_2 = tanh_a2_n * tanh_a2_n;
-
-			std::array<float,2> F;
-			F[0] = V_n[0] - V_n1[0] - half_T_wc*( tanh_a1_n + tanh_a1_n1 );
-        	F[1] = V_n[1] - V_n1[1] - half_T_wc*( tanh_a2_n + tanh_a2_n1 );
-
-        	// Jacobian matrix
-			std::array<std::array<float,2>,2> Jf;
-        	Jf[0][0] = 1.0f + half_T_wc_alpha*(1.0f - tanh_a1_n_2);
-        	Jf[0][1] = half_T_wc_alpha*(1.0f - tanh_a1_n_2)*k*dxFeedbackNL_n;
-        
-        	Jf[1][0] = -half_T_wc_beta*(1.0f - tanh_a2_n_2);
-        	Jf[1][1] = 1.0f - half_T_wc_beta*(1.0f - tanh_a2_n_2)*(k*dxFeedbackNL_n - 1);
-
-        	// (Determinant)^-1
-        	float one_det = 1.0f/( Jf[0][0]*Jf[1][1] - Jf[0][1]*Jf[1][0] );
-
-        	// Matrix invertion
-			std::array<std::array<float,2>,2> Jf_inv;
-	        Jf_inv[0][0] = one_det*Jf[1][1];
-	        Jf_inv[0][1] = -one_det*Jf[0][1];
-	        
-	        Jf_inv[1][0] = -one_det*Jf[1][0];
-	        Jf_inv[1][1] = one_det*Jf[0][0];
-
-			// Solve y = Ax + b
-			std::array<float,2> newtonRatio;
-	        newtonRatio[0] = Jf_inv[0][0]*F[0] + Jf_inv[0][1]*F[1];
-	        newtonRatio[1] = Jf_inv[1][0]*F[0] + Jf_inv[1][1]*F[1];
-
-	        // Compute new estimate
-	        V_n[0] = V_n[0] - newtonRatio[0];
-	        V_n[1] = V_n[1] - newtonRatio[1];
-
-	        if ( (std::abs(newtonRatio[0]) + std::abs(newtonRatio[1])) < 0.0001f)
-	        	break;
-
-		}
+		Equations equations(*this, Vin);
+		newton.solve<Newton::Adaptive>(equations, V_n, 0.0001f);
 
 		output = V_n[1];
 
 		// Update states
 		V_n1[0] = V_n[0];
 		V_n1[1] = V_n[1];
-        tanh_a1_n1 = tanh_a1_n;
-		tanh_a2_n1 = tanh_a2_n;
+		tanh_a1_n1 = equations.tanh_a1_n;
+		tanh_a2_n1 = equations.tanh_a2_n;
 		Vin_n1 = Vin;
 	}
 
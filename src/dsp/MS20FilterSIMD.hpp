@@ -0,0 +1,269 @@
+// CIRCUIT-BASED MODEL OF THE KORG MS20 LOWPASS FILTER (REV2), FOUR VOICES AT A TIME
+//
+// SAME MODEL AND SOLVER AS MS20Filter, BUT EACH LANE OF A float_4 IS AN INDEPENDENT
+// VOICE. THE EQUATIONS ARE SOLVED BY Newton::Solver (SEE Newton.hpp), WHICH KEEPS A PER-LANE
+// CONVERGENCE MASK: LANES THAT HAVE CONVERGED ARE FROZEN, AND THE LOOP EXITS AS SOON AS ALL
+// FOUR HAVE CONVERGED.
+// 
+// process() IS TEMPLATED ON THE tanh KERNEL (SEE FastMath.hpp), SO ACCURACY CAN BE
+// TRADED FOR SPEED WITHOUT A BRANCH INSIDE THE NEWTON LOOP.
+// 
+// IT IS ALSO TEMPLATED ON THE SOLVER STRATEGY (SEE THE SOLVER POLICIES BELOW). ONLY THE
+// REFERENCE NEWTON SOLVER HAS A VARIABLE COST; THE ECONOMY ONES RUN A FIXED NUMBER OF STEPS.
+// 
+// EACH SOLVE IS WARM-STARTED BY QUADRATIC EXTRAPOLATION FROM THE LAST THREE SOLUTIONS, AND
+// PER-LANE SOLVER STATISTICS (ITERATION HISTOGRAM, NON-CONVERGENCE, LARGEST FINAL STEP)
+// ARE KEPT IN stats.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef MS20FilterSIMD_H
+#define MS20FilterSIMD_H
+
+#include <rack.hpp>
+
+#include "FastMath.hpp"
+#include "LookupTables.hpp"
+#include "MS20Filter.hpp"
+#include "Newton.hpp"
+
+class MS20FilterSIMD {
+
+	using float_4 = rack::simd::float_4;
+	using int32_4 = rack::simd::int32_4;
+
+public:
+
+	// Newton-Raphson settings
+	static constexpr int maxIterations = 10;
+	static constexpr float tolerance = 0.0001f;
+	// Steps taken with the full Jacobian before it is damped (see process()), as in MS20Filter
+	static constexpr int fullNewtonSteps = MS20Filter::fullNewtonSteps;
+
+	// SOLVER POLICIES
+	//   iterations:  Newton steps per sample (the cost is fixed unless earlyExit)
+	//   earlyExit:   stop once every lane has converged
+	//   chord:       reuse the Jacobian inverse from the previous sample
+	//   extrapolate: start from the quadratic prediction instead of the last solution
+	//   fullSteps:   steps taken with the undamped Jacobian (see process())
+	// THE ECONOMY SOLVERS START FROM THE LAST SOLUTION AND ALWAYS DAMP: THEIR RESIDUAL ERROR
+	// IS AMPLIFIED BY THE EXTRAPOLATION, AND THEY NEVER GET A SECOND CHANCE AT THE FOLD.
+	// MAX ABSOLUTE DEVIATION FROM NewtonSolver (OUTPUT IN UNITS OF 5 V), 48 kHz, k = 0.5,
+	// SAWTOOTH INPUT, CUTOFF 100 Hz - 2 kHz: FixedNewton 1.5e-3, Chord 1.9e-3, SemiImplicit 7.5e-2.
+	// ERRORS GROW WITH CUTOFF AND RESONANCE, AND NEAR SELF-OSCILLATION ONLY THE LEVEL MATCHES.
+
+	struct NewtonSolver {
+	// REFERENCE: UP TO maxIterations STEPS
+		static constexpr int iterations = maxIterations;
+		static constexpr bool earlyExit = true;
+		static constexpr bool chord = false;
+		static constexpr bool extrapolate = true;
+		static constexpr int fullSteps = fullNewtonSteps;
+	};
+
+	struct FixedNewtonSolver {
+	// EXACTLY TWO NEWTON STEPS
+		static constexpr int iterations = 2;
+		static constexpr bool earlyExit = false;
+		static constexpr bool chord = false;
+		static constexpr bool extrapolate = false;
+		static constexpr int fullSteps = 0;
+	};
+
+	struct ChordSolver {
+	// TWO STEPS WITH THE PREVIOUS SAMPLE'S JACOBIAN, REFRESHED ONCE AT THE END OF THE
+	// SAMPLE (ONE DIVISION PER SAMPLE INSTEAD OF ONE PER STEP)
+		static constexpr int iterations = 2;
+		static constexpr bool earlyExit = false;
+		static constexpr bool chord = true;
+		static constexpr bool extrapolate = false;
+		static constexpr int fullSteps = 0;
+	};
+
+	struct SemiImplicitSolver {
+	// ONE NEWTON STEP, I.E. THE SYSTEM LINEARIZED AROUND THE LAST SOLUTION
+		static constexpr int iterations = 1;
+		static constexpr bool earlyExit = false;
+		static constexpr bool chord = false;
+		static constexpr bool extrapolate = false;
+		static constexpr int fullSteps = 0;
+	};
+
+	struct NewtonStats {
+		// histogram[lane][i] counts samples that took i iterations
+		uint32_t histogram[4][maxIterations + 1] = {};
+		// Samples that hit maxIterations without converging
+		int32_4 nonConverged = 0;
+		// Largest final Newton step (|dV0| + |dV1|)
+		float_4 largestFinalStep = 0.0f;
+	};
+
+	NewtonStats stats;
+
+private:
+
+	float_4 output = 0.0f;
+
+	// Defaults
+	float sampleRate = 44100.0f;
+	float T = 1.0f/44100.0f;
+	float piT = M_PI/44100.0f;
+
+	// Shared diode nonlinearity (see LookupTables.hpp)
+	const FastMath::DiodeSpline diodeFeedback;
+
+	// Constants from circuit components
+	const float alpha = 0.405246f;
+	const float beta = 0.413969f;
+
+	// State variables
+	float_4 V_n[2] = {0.0f, 0.0f};
+	float_4 V_n1[2] = {0.0f, 0.0f};
+	float_4 V_n2[2] = {0.0f, 0.0f};
+	float_4 V_n3[2] = {0.0f, 0.0f};
+
+	float_4 tanh_a1_n1 = 0.0f;
+	float_4 tanh_a2_n1 = 0.0f;
+
+	// Newton solver (keeps the chord method's Jacobian between samples)
+	Newton::Solver<float_4, 2> newton;
+
+	// parameter variables
+	float_4 k = 0.0f;
+
+	// temporary variables (related to parameters)
+	float_4 half_T_wc = 0.0f;
+	float_4 half_T_wc_alpha = 0.0f;
+	float_4 half_T_wc_beta = 0.0f;
+
+	// Residual and Jacobian of the trapezoidal discretization, for Newton::Solver
+	template <typename Tanh, typename Solver>
+	struct Equations {
+		const MS20FilterSIMD& f;
+		const float_4 Vin;
+		const Tanh tanh;
+
+		// tanh outputs from each lane's last evaluation
+		float_4 tanh_a1_n;
+		float_4 tanh_a2_n;
+
+		Equations(const MS20FilterSIMD& f, float_4 Vin)
+			: f(f), Vin(Vin), tanh(), tanh_a1_n(f.tanh_a1_n1), tanh_a2_n(f.tanh_a2_n1) {}
+
+		inline void evaluate(const float_4 (&V)[2], float_4 (&F)[2], float_4 (&J)[2][2], int i, float_4 active) {
+			// Diode feedback and its derivative w.r.t. V[1]
+			const float_4 kV = f.k*V[1];
+			float_4 dxFeedbackNL_n;
+			const float_4 feedbackNL_n = f.diodeFeedback(rack::simd::abs(kV), dxFeedbackNL_n);
+			float_4 kdFeedback = f.k*dxFeedbackNL_n*rack::simd::sgn(kV);
+
+			// Near the fold of the resonance loop (high k, cutoff close to Nyquist) the
+			// full Jacobian goes singular and Newton can jump to a runaway root. Lanes still
+			// iterating after Solver::fullSteps drop the regenerative part of the feedback slope,
+			// which keeps them bounded, as the old 1 mV-per-step table slope did
+			if (i >= Solver::fullSteps)
+				kdFeedback = rack::simd::fmin(kdFeedback, 0.0f);
+
+			const float_4 a1_n = f.alpha*(Vin - V[0] - feedbackNL_n);
+			const float_4 a2_n = f.beta*(V[0] - V[1] + feedbackNL_n);
+
+			const float_4 tanh_a1 = tanh(a1_n);
+			const float_4 tanh_a2 = tanh(a2_n);
+			const float_4 sech2_a1 = 1.0f - tanh_a1*tanh_a1;
+			const float_4 sech2_a2 = 1.0f - tanh_a2*tanh_a2;
+			tanh_a1_n = rack::simd::ifelse(active, tanh_a1, tanh_a1_n);
+			tanh_a2_n = rack::simd::ifelse(active, tanh_a2, tanh_a2_n);
+
+			// Residual
+			F[0] = V[0] - f.V_n1[0] - f.half_T_wc*(tanh_a1 + f.tanh_a1_n1);
+			F[1] = V[1] - f.V_n1[1] - f.half_T_wc*(tanh_a2 + f.tanh_a2_n1);
+
+			// Jacobian matrix
+			J[0][0] = 1.0f + f.half_T_wc_alpha*sech2_a1;
+			J[0][1] = f.half_T_wc_alpha*sech2_a1*kdFeedback;
+			J[1][0] = -f.half_T_wc_beta*sech2_a2;
+			J[1][1] = 1.0f - f.half_T_wc_beta*sech2_a2*(kdFeedback - 1.0f);
+		}
+	};
+
+public:
+	MS20FilterSIMD() {}
+	MS20FilterSIMD(float SR) {
+		setSampleRate(SR);
+	}
+	~MS20FilterSIMD() {}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		T = 1.0f/sampleRate;
+		piT = M_PI*T;
+	}
+
+	void reset() {
+		V_n[0] = 0.0f;
+		V_n[1] = 0.0f;
+		V_n1[0] = 0.0f;
+		V_n1[1] = 0.0f;
+		V_n2[0] = 0.0f;
+		V_n2[1] = 0.0f;
+		V_n3[0] = 0.0f;
+		V_n3[1] = 0.0f;
+		tanh_a1_n1 = 0.0f;
+		tanh_a2_n1 = 0.0f;
+		newton.reset();
+		output = 0.0f;
+	}
+
+	// Cheap enough to call every sample
+	void setParams(float_4 fc, float_4 resonance) {
+		k = resonance;
+
+		// Cutoff and prewarping: wc = 2*fs*tan(pi*fc*T)/alpha, so 0.5*T*wc reduces
+		// to tan(pi*fc*T)/alpha (kept just below Nyquist)
+		const float_4 theta = rack::simd::fmin(piT*fc, 1.5f);
+		half_T_wc = FastMath::tan(theta) * (1.0f/alpha);
+		half_T_wc_alpha = half_T_wc * alpha;
+		half_T_wc_beta = half_T_wc * beta;
+	}
+
+	template <typename Tanh = FastMath::TanhExact, typename Solver = NewtonSolver>
+	void process(float_4 Vin) {
+		// Warm start: extrapolate a parabola through the last three solutions
+		if (Solver::extrapolate) {
+			V_n[0] = 3.0f*(V_n1[0] - V_n2[0]) + V_n3[0];
+			V_n[1] = 3.0f*(V_n1[1] - V_n2[1]) + V_n3[1];
+		}
+		else {
+			V_n[0] = V_n1[0];
+			V_n[1] = V_n1[1];
+		}
+
+		Equations<Tanh, Solver> equations(*this, Vin);
+		const Newton::Result<float_4> result = newton.solve<Solver>(equations, V_n, tolerance);
+
+		// Telemetry (the unconverged mask is -1 per lane)
+		const int32_4 iterationCount = int32_4(result.iterations);
+		for (int lane = 0; lane < 4; lane++)
+			stats.histogram[lane][iterationCount[lane]]++;
+		stats.nonConverged = _mm_sub_epi32(stats.nonConverged.v, _mm_castps_si128(result.unconverged.v));
+		stats.largestFinalStep = rack::simd::fmax(stats.largestFinalStep, result.step);
+
+		output = V_n[1];
+
+		// Update states
+		V_n3[0] = V_n2[0];
+		V_n3[1] = V_n2[1];
+		V_n2[0] = V_n1[0];
+		V_n2[1] = V_n1[1];
+		V_n1[0] = V_n[0];
+		V_n1[1] = V_n[1];
+		tanh_a1_n1 = equations.tanh_a1_n;
+		tanh_a2_n1 = equations.tanh_a2_n;
+	}
+
+	inline float_4 getOutput() const noexcept {
+		return output;
+	}
+
+};
+
+#endif
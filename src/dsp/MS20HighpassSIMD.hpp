@@ -0,0 +1,187 @@
+// CIRCUIT-BASED MODEL OF THE KORG MS20 HIGHPASS FILTER (REV2), FOUR VOICES AT A TIME
+//
+// THE HIGHPASS STAGE IS THE LOWPASS TOPOLOGY WITH CAPACITORS AND RESISTORS SWAPPED: THE STATES
+// ARE THE TWO CAPACITOR VOLTAGES u1, u2 AND THE OUTPUT IS y = Vin - u1 - u2. THE DIODE CLIPPER
+// IN THE FEEDBACK PATH SEES THE (BIPOLAR) OUTPUT, SO HERE IT IS APPLIED AS AN ODD FUNCTION.
+// WITH SMALL SIGNALS
+// 	H(s) = s^2 / (s^2 + (3 - K)*wc*s + wc^2),  K = 2.22*k (THE DIODE SLOPE AT 0)
+// SO THE FILTER SELF-OSCILLATES FROM k = 1.35.
+//
+// THE TRAPEZOIDAL DISCRETIZATION IS SOLVED BY Newton::Solver (SEE Newton.hpp), WARM-STARTED
+// BY QUADRATIC EXTRAPOLATION AND DAMPED NEAR THE FOLD OF THE RESONANCE LOOP AS IN
+// MS20FilterSIMD. process() IS TEMPLATED ON THE tanh KERNEL (SEE FastMath.hpp).
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef MS20HighpassSIMD_H
+#define MS20HighpassSIMD_H
+
+#include <rack.hpp>
+
+#include "FastMath.hpp"
+#include "Newton.hpp"
+
+class MS20HighpassSIMD {
+
+	using float_4 = rack::simd::float_4;
+
+public:
+
+	// Newton-Raphson settings
+	static constexpr int maxIterations = 10;
+	static constexpr float tolerance = 0.0001f;
+	// Steps taken with the full Jacobian before it is damped
+	static constexpr int fullNewtonSteps = 2;
+
+	struct NewtonSolver {
+		static constexpr int iterations = maxIterations;
+		static constexpr bool earlyExit = true;
+		static constexpr bool chord = false;
+	};
+
+private:
+
+	float_4 output = 0.0f;
+
+	// Defaults
+	float sampleRate = 44100.0f;
+	float T = 1.0f/44100.0f;
+	float piT = M_PI/44100.0f;
+
+	// Shared diode nonlinearity (see LookupTables.hpp)
+	const FastMath::DiodeSpline diodeFeedback;
+
+	// Constant from circuit components
+	const float alpha = 0.405246f;
+
+	// State variables (capacitor voltages)
+	float_4 u_n[2] = {0.0f, 0.0f};
+	float_4 u_n1[2] = {0.0f, 0.0f};
+	float_4 u_n2[2] = {0.0f, 0.0f};
+	float_4 u_n3[2] = {0.0f, 0.0f};
+
+	float_4 tanh_h_n1 = 0.0f;
+	float_4 tanh_y_n1 = 0.0f;
+
+	Newton::Solver<float_4, 2> newton;
+
+	// parameter variables
+	float_4 k = 0.0f;
+
+	// temporary variables (related to parameters)
+	float_4 half_T_wc = 0.0f;
+	float_4 half_T_wc_alpha = 0.0f;
+
+	// Residual and Jacobian of the trapezoidal discretization, for Newton::Solver
+	template <typename Tanh>
+	struct Equations {
+		const MS20HighpassSIMD& f;
+		const float_4 Vin;
+		const Tanh tanh;
+
+		// tanh outputs from each lane's last evaluation
+		float_4 tanh_h_n;
+		float_4 tanh_y_n;
+
+		Equations(const MS20HighpassSIMD& f, float_4 Vin)
+			: f(f), Vin(Vin), tanh(), tanh_h_n(f.tanh_h_n1), tanh_y_n(f.tanh_y_n1) {}
+
+		inline void evaluate(const float_4 (&u)[2], float_4 (&F)[2], float_4 (&J)[2][2], int i, float_4 active) {
+			const float_4 y = Vin - u[0] - u[1];
+
+			// Odd diode feedback and its derivative w.r.t. y
+			const float_4 ky = f.k*y;
+			const float_4 sign = ky & -0.0f;
+			float_4 dxFeedbackNL_n;
+			const float_4 feedbackNL_n = f.diodeFeedback(rack::simd::abs(ky), dxFeedbackNL_n) ^ sign;
+			float_4 kdFeedback = f.k*dxFeedbackNL_n;
+
+			// The feedback slope is always regenerative here; drop it once the full steps
+			// are spent, which keeps lanes near the fold bounded (see MS20FilterSIMD)
+			if (i >= fullNewtonSteps)
+				kdFeedback = 0.0f;
+
+			const float_4 h_n = Vin - u[0] - feedbackNL_n;
+
+			const float_4 tanh_h = tanh(f.alpha*h_n);
+			const float_4 tanh_y = tanh(f.alpha*y);
+			const float_4 sech2_h = 1.0f - tanh_h*tanh_h;
+			const float_4 sech2_y = 1.0f - tanh_y*tanh_y;
+			tanh_h_n = rack::simd::ifelse(active, tanh_h, tanh_h_n);
+			tanh_y_n = rack::simd::ifelse(active, tanh_y, tanh_y_n);
+
+			// Residual: u1 charges with both currents, u2 with the output current
+			F[0] = u[0] - f.u_n1[0] - f.half_T_wc*(tanh_h + tanh_y + f.tanh_h_n1 + f.tanh_y_n1);
+			F[1] = u[1] - f.u_n1[1] - f.half_T_wc*(tanh_y + f.tanh_y_n1);
+
+			// Jacobian matrix
+			J[0][0] = 1.0f + f.half_T_wc_alpha*(sech2_y + sech2_h*(1.0f - kdFeedback));
+			J[0][1] = f.half_T_wc_alpha*(sech2_y - sech2_h*kdFeedback);
+			J[1][0] = f.half_T_wc_alpha*sech2_y;
+			J[1][1] = 1.0f + f.half_T_wc_alpha*sech2_y;
+		}
+	};
+
+public:
+	MS20HighpassSIMD() {}
+	MS20HighpassSIMD(float SR) {
+		setSampleRate(SR);
+	}
+	~MS20HighpassSIMD() {}
+
+	void setSampleRate(float SR) {
+		sampleRate = SR;
+		T = 1.0f/sampleRate;
+		piT = M_PI*T;
+	}
+
+	void reset() {
+		for (int i = 0; i < 2; i++) {
+			u_n[i] = 0.0f;
+			u_n1[i] = 0.0f;
+			u_n2[i] = 0.0f;
+			u_n3[i] = 0.0f;
+		}
+		tanh_h_n1 = 0.0f;
+		tanh_y_n1 = 0.0f;
+		newton.reset();
+		output = 0.0f;
+	}
+
+	// Cheap enough to call every sample
+	void setParams(float_4 fc, float_4 resonance) {
+		k = resonance;
+
+		// Cutoff and prewarping, as in MS20FilterSIMD
+		const float_4 theta = rack::simd::fmin(piT*fc, 1.5f);
+		half_T_wc = FastMath::tan(theta) * (1.0f/alpha);
+		half_T_wc_alpha = half_T_wc * alpha;
+	}
+
+	template <typename Tanh = FastMath::TanhExact>
+	void process(float_4 Vin) {
+		// Warm start: extrapolate a parabola through the last three solutions
+		u_n[0] = 3.0f*(u_n1[0] - u_n2[0]) + u_n3[0];
+		u_n[1] = 3.0f*(u_n1[1] - u_n2[1]) + u_n3[1];
+
+		Equations<Tanh> equations(*this, Vin);
+		newton.solve<NewtonSolver>(equations, u_n, tolerance);
+
+		output = Vin - u_n[0] - u_n[1];
+
+		// Update states
+		for (int i = 0; i < 2; i++) {
+			u_n3[i] = u_n2[i];
+			u_n2[i] = u_n1[i];
+			u_n1[i] = u_n[i];
+		}
+		tanh_h_n1 = equations.tanh_h_n;
+		tanh_y_n1 = equations.tanh_y_n;
+	}
+
+	inline float_4 getOutput() const noexcept {
+		return output;
+	}
+
+};
+
+#endif
@@ -0,0 +1,186 @@
+// NEWTON-RAPHSON SOLVER FOR SMALL NONLINEAR SYSTEMS
+//
+// Newton::Solver<T, N> SOLVES F(x) = 0 FOR AN N-STATE SYSTEM, WHERE T IS float (ONE VOICE)
+// OR float_4 (FOUR VOICES, ONE PER LANE). THE SYSTEM IS A FUNCTOR WITH
+//
+//     void evaluate(const T (&x)[N], T (&F)[N], T (&J)[N][N], int iteration, Mask active)
+//
+// WHICH FILLS IN THE RESIDUAL AND ITS JACOBIAN AT x. active MARKS THE LANES STILL ITERATING,
+// SO THE SYSTEM CAN HOLD ON TO VALUES (E.G. tanh OUTPUTS) FROM THEIR LAST EVALUATION.
+// ITERATION COUNT, EARLY EXIT AND THE CHORD METHOD ARE CHOSEN BY A POLICY STRUCT:
+//
+//     struct Policy {
+//         static constexpr int iterations;   // maximum (or fixed) number of steps
+//         static constexpr bool earlyExit;   // stop once every lane has converged
+//         static constexpr bool chord;       // reuse the Jacobian inverse from the last solve
+//     };
+//
+// EVERYTHING IS SIZED AT COMPILE TIME, SO THE LOOPS UNROLL AND THE 2x2 CASE COMPILES TO THE
+// SAME EXPLICIT INVERSE AS A HAND-WRITTEN SOLVER. LARGER SYSTEMS USE GAUSS-JORDAN WITHOUT
+// PIVOTING, WHICH IS FINE FOR THE DIAGONALLY DOMINANT JACOBIANS OF IMPLICIT INTEGRATORS.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef NEWTON_H
+#define NEWTON_H
+
+#include <cmath>
+#include <rack.hpp>
+
+namespace Newton {
+
+using rack::simd::float_4;
+
+// Per-lane helpers, so the solver is written once for float and float_4
+template <typename T>
+struct Lanes;
+
+template <>
+struct Lanes<float> {
+	typedef bool Mask;
+	static bool all() noexcept { return true; }
+	static bool any(bool m) noexcept { return m; }
+	static bool both(bool a, bool b) noexcept { return a && b; }
+	static float select(bool m, float a, float b) noexcept { return m ? a : b; }
+	static float only(bool m, float x) noexcept { return m ? x : 0.0f; }
+	static float abs(float x) noexcept { return std::fabs(x); }
+};
+
+template <>
+struct Lanes<float_4> {
+	typedef float_4 Mask;
+	static float_4 all() noexcept { return float_4::mask(); }
+	static bool any(float_4 m) noexcept { return rack::simd::movemask(m) != 0; }
+	static float_4 both(float_4 a, float_4 b) noexcept { return a & b; }
+	static float_4 select(float_4 m, float_4 a, float_4 b) noexcept { return rack::simd::ifelse(m, a, b); }
+	static float_4 only(float_4 m, float_4 x) noexcept { return x & m; }
+	static float_4 abs(float_4 x) noexcept { return rack::simd::abs(x); }
+};
+
+// Matrix inverse, Gauss-Jordan without pivoting
+template <typename T, int N>
+inline void invert(const T (&J)[N][N], T (&inv)[N][N]) noexcept {
+	T a[N][N];
+	for (int r = 0; r < N; r++) {
+		for (int c = 0; c < N; c++) {
+			a[r][c] = J[r][c];
+			inv[r][c] = (r == c) ? T(1.0f) : T(0.0f);
+		}
+	}
+
+	for (int p = 0; p < N; p++) {
+		const T onePivot = 1.0f/a[p][p];
+		for (int c = 0; c < N; c++) {
+			a[p][c] *= onePivot;
+			inv[p][c] *= onePivot;
+		}
+		for (int r = 0; r < N; r++) {
+			if (r == p)
+				continue;
+			const T f = a[r][p];
+			for (int c = 0; c < N; c++) {
+				a[r][c] -= f*a[p][c];
+				inv[r][c] -= f*inv[p][c];
+			}
+		}
+	}
+}
+
+// 2x2: explicit inverse, one division
+template <typename T>
+inline void invert(const T (&J)[2][2], T (&inv)[2][2]) noexcept {
+	const T one_det = 1.0f/(J[0][0]*J[1][1] - J[0][1]*J[1][0]);
+	inv[0][0] = one_det*J[1][1];
+	inv[0][1] = -one_det*J[0][1];
+	inv[1][0] = -one_det*J[1][0];
+	inv[1][1] = one_det*J[0][0];
+}
+
+template <typename T>
+struct Result {
+	// Steps taken, per lane
+	T iterations = 0.0f;
+	// Size of the last step taken, sum of |delta| over the states
+	T step = 0.0f;
+	// Lanes that hadn't converged when the solver stopped
+	typename Lanes<T>::Mask unconverged;
+};
+
+// Adaptive reference solver: up to 10 steps, stops when every lane has converged
+struct Adaptive {
+	static constexpr int iterations = 10;
+	static constexpr bool earlyExit = true;
+	static constexpr bool chord = false;
+};
+
+template <typename T, int N>
+class Solver {
+private:
+	typedef Lanes<T> L;
+
+	// Jacobian inverse from the last evaluation (used by the chord method)
+	T Jinv[N][N];
+
+public:
+	Solver() {
+		reset();
+	}
+
+	void reset() {
+		for (int r = 0; r < N; r++)
+			for (int c = 0; c < N; c++)
+				Jinv[r][c] = (r == c) ? T(1.0f) : T(0.0f);
+	}
+
+	// Refines x in place, starting from the initial guess it holds
+	template <typename Policy, typename System>
+	inline Result<T> solve(System& system, T (&x)[N], float tolerance) {
+		Result<T> result;
+		typename L::Mask active = L::all();
+
+		T F[N];
+		T J[N][N];
+		T inv[N][N];
+
+		for (int i = 0; i < Policy::iterations; i++) {
+			result.iterations += L::only(active, 1.0f);
+
+			system.evaluate(x, F, J, i, active);
+
+			// Solve J*delta = F, with the current Jacobian or the stored one (chord)
+			if (Policy::chord) {
+				for (int r = 0; r < N; r++)
+					for (int c = 0; c < N; c++)
+						inv[r][c] = Jinv[r][c];
+			}
+			else {
+				invert(J, inv);
+			}
+
+			// Update only the lanes that haven't converged yet
+			T step = 0.0f;
+			for (int r = 0; r < N; r++) {
+				T delta = inv[r][0]*F[0];
+				for (int c = 1; c < N; c++)
+					delta += inv[r][c]*F[c];
+				x[r] -= L::only(active, delta);
+				step += L::abs(delta);
+			}
+
+			result.step = L::select(active, step, result.step);
+			active = L::both(active, step >= tolerance);
+			if (Policy::earlyExit && !L::any(active))
+				break;
+		}
+
+		// Refresh the chord Jacobian from the last evaluation
+		if (Policy::chord && Policy::iterations > 0)
+			invert(J, Jinv);
+
+		result.unconverged = active;
+		return result;
+	}
+};
+
+} // namespace Newton
+
+#endif
@@ -0,0 +1,62 @@
+// VECTORIZED WHITE NOISE
+//
+// FOUR INDEPENDENT xorshift32 GENERATORS, ONE PER SIMD LANE, STEPPED TOGETHER WITH INTEGER
+// SSE OPERATIONS. EACH CALL RETURNS FOUR UNIFORM SAMPLES IN [-1, 1); CALL TWICE FOR EIGHT.
+// THE SEQUENCE DEPENDS ONLY ON THE SEED, SO A FIXED SEED GIVES BIT-REPEATABLE OUTPUT.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef NOISE_H
+#define NOISE_H
+
+#include <cstdint>
+#include <rack.hpp>
+
+namespace Noise {
+
+using rack::simd::float_4;
+using rack::simd::int32_4;
+
+class XorshiftNoise {
+private:
+	int32_4 state = 0;
+
+	// splitmix32-style hash, so nearby seeds and lanes give unrelated streams
+	static uint32_t hash(uint32_t x) noexcept {
+		x += 0x9e3779b9u;
+		x = (x ^ (x >> 16)) * 0x85ebca6bu;
+		x = (x ^ (x >> 13)) * 0xc2b2ae35u;
+		return x ^ (x >> 16);
+	}
+
+public:
+	XorshiftNoise() {
+		seed(0);
+	}
+
+	// stream selects one of several generators sharing a seed (e.g. one per voice group)
+	void seed(uint32_t seed, uint32_t stream = 0) noexcept {
+		for (int lane = 0; lane < 4; lane++) {
+			uint32_t s = hash(seed ^ hash(4*stream + lane));
+			// xorshift never leaves the all-zero state
+			state.s[lane] = (int32_t) (s ? s : 0x6d2b79f5u);
+		}
+	}
+
+	inline float_4 process() noexcept {
+		// Logical shifts (int32_4's >> is arithmetic)
+		__m128i x = state.v;
+		x = _mm_xor_si128(x, _mm_slli_epi32(x, 13));
+		x = _mm_xor_si128(x, _mm_srli_epi32(x, 17));
+		x = _mm_xor_si128(x, _mm_slli_epi32(x, 5));
+		state.v = x;
+
+		// Top 23 bits as the mantissa of a float in [1, 2), then mapped to [-1, 1)
+		const __m128i one = _mm_set1_epi32(0x3f800000);
+		const float_4 u = _mm_castsi128_ps(_mm_or_si128(_mm_srli_epi32(x, 9), one));
+		return 2.0f*u - 3.0f;
+	}
+};
+
+} // namespace Noise
+
+#endif
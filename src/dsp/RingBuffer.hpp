@@ -0,0 +1,74 @@
+// LOCK-FREE SINGLE-PRODUCER, SINGLE-CONSUMER RING BUFFER
+//
+// CARRIES SMALL FIXED-SIZE RECORDS FROM THE AUDIO THREAD TO THE UI THREAD. push() AND pop()
+// NEVER BLOCK, NEVER ALLOCATE AND NEVER TAKE A LOCK: THE PRODUCER ONLY WRITES writeIndex AND
+// THE CONSUMER ONLY WRITES readIndex, AND EACH PUBLISHES ITS INDEX WITH A RELEASE STORE AFTER
+// TOUCHING THE SLOT. WHEN THE BUFFER IS FULL push() DROPS THE NEW RECORD, SO A CONSUMER THAT
+// STOPS READING (E.G. A CLOSED DISPLAY) COSTS THE PRODUCER NOTHING BUT THE INDEX LOADS.
+//
+// EXACTLY ONE THREAD MAY CALL push() AND EXACTLY ONE (POSSIBLY OTHER) THREAD MAY CALL pop().
+// T SHOULD BE TRIVIALLY COPYABLE, AND S MUST BE A POWER OF TWO.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+template <typename T, size_t S>
+class SPSCRingBuffer {
+
+	static_assert(S > 0 && (S & (S - 1)) == 0, "SPSCRingBuffer size must be a power of two");
+
+private:
+
+	// Free-running indices, wrapped with a mask on access. Padding keeps them on separate
+	// cache lines, so the two threads don't invalidate each other's line on every update
+	// (padding rather than alignas, which heap allocation doesn't honour before C++17)
+	static constexpr size_t cacheLine = 64;
+	std::atomic<uint32_t> writeIndex{0};
+	char writePadding[cacheLine - sizeof(std::atomic<uint32_t>)];
+	std::atomic<uint32_t> readIndex{0};
+	char readPadding[cacheLine - sizeof(std::atomic<uint32_t>)];
+	T data[S];
+
+public:
+
+	// Producer side. Returns false (and drops t) when the buffer is full
+	bool push(const T& t) noexcept {
+		const uint32_t w = writeIndex.load(std::memory_order_relaxed);
+		if (w - readIndex.load(std::memory_order_acquire) >= S)
+			return false;
+		data[w & (S - 1)] = t;
+		writeIndex.store(w + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. Returns false when the buffer is empty
+	bool pop(T& t) noexcept {
+		const uint32_t r = readIndex.load(std::memory_order_relaxed);
+		if (r == writeIndex.load(std::memory_order_acquire))
+			return false;
+		t = data[r & (S - 1)];
+		readIndex.store(r + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer side. Discards everything written so far
+	void clear() noexcept {
+		readIndex.store(writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+	}
+
+	// Approximate when called while the other thread is active
+	size_t size() const noexcept {
+		return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+	}
+
+	static constexpr size_t capacity() noexcept {
+		return S;
+	}
+};
+
+#endif
@@ -14,6 +14,81 @@
 #ifndef WAVESHAPING_H
 #define WAVESHAPING_H 
 
+#include <cmath>
+
+#include "FastMath.hpp"
+
+namespace Waveshaping {
+
+// STATELESS KERNELS: THE HARD CLIPPING AND FOLDING FUNCTIONS AND THEIR ANTIDERIVATIVES.
+// SHARED BY THE CLASSES BELOW AND BY THEIR float_4 COUNTERPARTS (SEE WaveshapingSIMD.hpp).
+
+// Ill-conditioning threshold of the antiderivative method
+constexpr float thresh = 10.0e-2f;
+
+// The soft clipper's antiderivative is smooth, so its difference quotient only loses the
+// rounding of the two antiderivatives (about 2e-7/|x - xn1|) and can be used much closer to
+// the diagonal. The midpoint rule is then rare enough to be evaluated only when a lane needs it
+constexpr float softClipThresh = 5.0e-3f;
+
+constexpr float signum(float x) {
+	return (x > 0.0f) ? 1.0f : ((x < 0.0f) ? -1.0f : 0.0f);
+}
+
+constexpr float hardClipN0(float x) {
+	// Hard clipping function
+	return 0.5f*(signum(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f));
+}
+
+constexpr float hardClipN1(float x) {
+	// First antiderivative of hardClipN0
+	return 0.25f*(signum(x+1.0f)*(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f)*(x-1.0f) - 2.0f);
+}
+
+constexpr float hardClipN2(float x) {
+	// Second antiderivative of hardClipN0
+	return (1.0f/12.0f)*(signum(x+1.0f)*(x+1.0f)*(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f)*(x-1.0f)*(x-1.0f) - 6.0f*x);
+}
+
+constexpr float foldFunctionN0(float x) {
+	// Folding function
+	return (2.0f*hardClipN0(x) - x);
+}
+
+constexpr float foldFunctionN1(float x) {
+	// First antiderivative of the folding function
+	return (2.0f*hardClipN1(x) - 0.5f*x*x);
+}
+
+constexpr float foldFunctionN2(float x) {
+	// Second antiderivative of the folding function
+	return (2.0f*hardClipN2(x) - (1.0f/6.0f)*(x*x*x));
+}
+
+// Soft clipping function sin(pi/2*x), saturating outside [-1 1], at the midpoint of a and b
+// (the escape rule of the antialiased soft clipper). Odd degree-5 minimax polynomial in a + b,
+// fitted to stay at or below 1 so that it reaches 1 exactly at the clamp.
+// Max error: 8.1e-5. Templated, so float and float_4 evaluate the same expression
+template <typename T>
+inline T softClipN0Midpoint(T a, T b) {
+	const T s = FastMath::clampSym(a + b, 2.0f);
+	const T s2 = s*s;
+	return s*(7.851214446e-01f + s2*(-8.021386645e-02f + s2*2.233376323e-03f));
+}
+
+// First antiderivative of the soft clipping function: 1 - 2/pi*cos(pi/2*x) inside [-1 1],
+// |x| outside. The exact integral of the polynomial above (even, degree 6), so the difference
+// quotient averages the same curve that the midpoint rule samples. It lies above |x| inside
+// [-1 1] and meets it at +-1, which lets a max() join the two pieces
+template <typename T>
+inline T softClipN1(T x) {
+	const T u = rack::simd::fmin(x*x, 1.0f);
+	return rack::simd::fmax(rack::simd::abs(x),
+		3.633949479e-01f + u*(7.851214446e-01f + u*(-1.604277329e-01f + u*1.191134039e-02f)));
+}
+
+} // namespace Waveshaping
+
 class HardClipper {
 
 // THIS CLASS IMPLEMENTS AN ANTIALIASED HARD CLIPPING FUNCTION.
@@ -24,12 +99,8 @@ private:
 	float output = 0.0;
 
 	float xn1 = 0.0;
-	float Fn = 0.0;
 	float Fn1 = 0.0;
 
-	const float thresh = 10.0e-2;
-	const float oneTwelfth = 1.0/12.0;
-
 public:
 
 	HardClipper() {}
@@ -39,29 +110,11 @@ public:
 		output = antialiasedHardClipN1(input);
 	}
 
-	float signum(float x) {
-		return (x > 0.0f) ? 1.0f : ((x < 0.0f) ? -1.0f : 0.0f);
-	}
-
-	float hardClipN0(float x) {
-		// Hard clipping function
-		return 0.5f*(signum(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f)); 
-	}
-
-	float hardClipN1(float x) {
-		// First antiderivative of hardClipN0
-		return 0.25f*(signum(x+1.0f)*(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f)*(x-1.0f) - 2.0f); 
-	}
-
-	float hardClipN2(float x) {
-		// second antiderivative of hardClipN0
-		return oneTwelfth*(signum(x+1.0f)*(x+1.0f)*(x+1.0f)*(x+1.0f) - signum(x-1.0f)*(x-1.0f)*(x-1.0f)*(x-1.0f) - 6.0f*x); 
-	}
-
 	float antialiasedHardClipN1(float x) {
+		using namespace Waveshaping;
 
 		// Hard clipping with 1st-order antialiasing
-		Fn = hardClipN1(x);
+		float Fn = hardClipN1(x);
 		float tmp = 0.0;
 		if (std::abs(x - xn1) < thresh) {
 			tmp = hardClipN0(0.5f * (x + xn1));
@@ -95,18 +148,9 @@ private:
 	// Antialiasing state variables
 	float xn1 = 0.0;
 	float xn2 = 0.0;
-	float Fn = 0.0;
 	float Fn1 = 0.0;
-	float Gn = 0.0;
 	float Gn1 = 0.0;
 
-	// Ill-conditioning threshold
-	const float thresh = 10.0e-2;
-
-	const float oneSixth = 1.0/6.0;
-
-	HardClipper hardClipper;
-
 public:
 
 	Wavefolder() {}
@@ -116,25 +160,11 @@ public:
 		output = antialiasedFoldN2(input);
 	}
 
-	float foldFunctionN0(float x) {
-		// Folding function
-		return (2.0f*hardClipper.hardClipN0(x) - x);
-	}
-
-	float foldFunctionN1(float x) {	
-		// First antiderivative of the folding function
-		return (2.0f*hardClipper.hardClipN1(x) - 0.5f*x*x);
-	}
-
-	float foldFunctionN2(float x) {	
-		// Second antiderivative of the folding function
-		return (2.0f*hardClipper.hardClipN2(x) - oneSixth*(x*x*x));
-	}
-
 	float antialiasedFoldN1(float x) {
+		using namespace Waveshaping;
 
 		// Folding with 1st-order antialiasing (not recommended)
-		Fn = foldFunctionN1(x);
+		float Fn = foldFunctionN1(x);
 		float tmp = 0.0;
 		if (std::abs(x - xn1) < thresh) {
 			tmp = foldFunctionN0(0.5f * (x + xn1));
@@ -151,9 +181,11 @@ public:
 	}
 
 	float antialiasedFoldN2(float x) {
+		using namespace Waveshaping;
 
 		// Folding with 2nd-order antialiasing
-		Fn = foldFunctionN2(x);
+		float Fn = foldFunctionN2(x);
+		float Gn = 0.0;
 		float tmp = 0.0;
 		if (std::abs(x - xn1) < thresh) {
 			// First-order escape rule
@@ -203,11 +235,9 @@ private:
 
 	float output = 0.0;
 
-	// Antialiasing variables
+	// Antialiasing variables (Fn1 starts at the antiderivative of xn1, which is not 0)
 	float xn1 = 0.0;
-	float Fn = 0.0;
-	float Fn1 = 0.0;
-	const float thresh = 10.0e-2;
+	float Fn1 = Waveshaping::softClipN1(0.0f);
 
 public:
 	SoftClipper() {}
@@ -217,25 +247,13 @@ public:
 		output = antialiasedSoftClipN1(input);
 	}
 
-	float signum(float x) {
-		return (x > 0.0f) ? 1.0f : ((x < 0.0f) ? -1.0f : 0.0f);
-	}
-
-	float softClipN0(float x) {
-		return (std::abs(x)<1) ? std::sin(0.5f*M_PI*x) : signum(x); 
-	}
-
-	float softClipN1(float x) {
-		
-		return (std::abs(x)<1) ? 1.0f - (2.0f/M_PI)*cos(x*0.5f*M_PI) : signum(x)*x;
-	}
-
 	float antialiasedSoftClipN1(float x) {
+		using namespace Waveshaping;
 
-		Fn = softClipN1(x);
+		float Fn = softClipN1(x);
 		float tmp = 0.0;
-		if (std::abs(x - xn1) < thresh) {
-			tmp = softClipN0(0.5f * (x + xn1));
+		if (std::abs(x - xn1) < softClipThresh) {
+			tmp = softClipN0Midpoint(x, xn1);
 		}
 		else {
 			tmp = (Fn - Fn1)/(x - xn1);
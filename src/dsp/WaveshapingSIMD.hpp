@@ -0,0 +1,354 @@
+// WAVESHAPING CLASSES, FOUR VOICES AT A TIME
+//
+// SAME ANTIDERIVATIVE ANTIALIASING AS Waveshaping.hpp, BUT EACH LANE OF A float_4 IS AN
+// INDEPENDENT VOICE. THE ILL-CONDITIONING ESCAPE RULES ARE COMPUTED ALONGSIDE THE REGULAR
+// DIFFERENCE QUOTIENTS AND SELECTED PER LANE WITH A MASK, SO THE COMMON PATHS HAVE NO
+// DATA-DEPENDENT BRANCHES. LANES THAT TAKE AN ESCAPE RULE MAY DIVIDE BY (NEAR) ZERO IN THE
+// DISCARDED BRANCH; THAT RESULT IS NEVER SELECTED.
+//
+// THE KERNELS USE sgn(a)*a = |a| AND OTHERWISE EVALUATE THE SAME EXPRESSIONS, IN THE SAME
+// ORDER, AS THE SCALAR CLASSES, SO THE OUTPUT MATCHES THEM BIT FOR BIT (WITHOUT FMA
+// CONTRACTION). KEEP IT THAT WAY: THE SECOND-ORDER DIFFERENCES AMPLIFY ROUNDING ERRORS, AND
+// EVEN A REORDERED DIVISION MOVES THE 4-STAGE CASCADE BY UP TO 0.05 V AT HIGH FOLD SETTINGS.
+//
+// THIS CODE IS PROVIDED "AS-IS", WITH NO GUARANTEE OF ANY KIND.
+#ifndef WAVESHAPINGSIMD_H
+#define WAVESHAPINGSIMD_H
+
+#include <rack.hpp>
+
+#include "Waveshaping.hpp"
+
+namespace Waveshaping {
+
+using rack::simd::float_4;
+
+// float_4 overloads of the kernels in Waveshaping.hpp
+
+inline float_4 hardClipN0(float_4 x) noexcept {
+	return 0.5f*(rack::simd::abs(x+1.0f) - rack::simd::abs(x-1.0f));
+}
+
+inline float_4 hardClipN1(float_4 x) noexcept {
+	return 0.25f*(rack::simd::abs(x+1.0f)*(x+1.0f) - rack::simd::abs(x-1.0f)*(x-1.0f) - 2.0f);
+}
+
+inline float_4 hardClipN2(float_4 x) noexcept {
+	const float_4 xp = x+1.0f;
+	const float_4 xm = x-1.0f;
+	return (1.0f/12.0f)*(rack::simd::abs(xp)*xp*xp - rack::simd::abs(xm)*xm*xm - 6.0f*x);
+}
+
+inline float_4 foldFunctionN0(float_4 x) noexcept {
+	return (2.0f*hardClipN0(x) - x);
+}
+
+inline float_4 foldFunctionN1(float_4 x) noexcept {
+	return (2.0f*hardClipN1(x) - 0.5f*x*x);
+}
+
+inline float_4 foldFunctionN2(float_4 x) noexcept {
+	return (2.0f*hardClipN2(x) - (1.0f/6.0f)*(x*x*x));
+}
+
+// One folding stage with 1st-order antialiasing, see Wavefolder::antialiasedFoldN1
+inline float_4 antialiasedFoldN1(float_4 x, float_4& xn1, float_4& Fn1) noexcept {
+	const float_4 Fn = foldFunctionN1(x);
+	const float_4 y = rack::simd::ifelse(rack::simd::abs(x - xn1) < thresh,
+		foldFunctionN0(0.5f * (x + xn1)),
+		(Fn - Fn1)/(x - xn1));
+
+	// Update state variables
+	xn1 = x;
+	Fn1 = Fn;
+
+	return y;
+}
+
+// One folding stage with 2nd-order antialiasing, see Wavefolder::antialiasedFoldN2.
+// The stage's state is passed in, so a cascade can keep it in whatever layout suits it
+inline float_4 antialiasedFoldN2(float_4 x, float_4& xn1, float_4& xn2, float_4& Fn1, float_4& Gn1) noexcept {
+	using rack::simd::abs;
+	using rack::simd::ifelse;
+
+	const float_4 Fn = foldFunctionN2(x);
+
+	// First-order escape rule where x is close to xn1
+	const float_4 Gn = ifelse(abs(x - xn1) < thresh,
+		foldFunctionN1(0.5f * (x + xn1)),
+		(Fn - Fn1) / (x - xn1));
+
+	// Second-order escape rule where x is close to xn2. Where the three samples are
+	// also nearly collinear it reduces to the midpoint rule; otherwise (a sharp turn
+	// between close samples, which is rare) it needs two more antiderivatives and two
+	// divisions, so that branch is only evaluated when some lane takes it
+	const float_4 delta = 0.5f * (x - 2.0f*xn1 + xn2);
+	const float_4 nearXn2 = abs(x - xn2) < thresh;
+	const float_4 collinear = abs(delta) < thresh;
+
+	float_4 escape = foldFunctionN0(0.25f * (x + 2.0f*xn1 + xn2));
+	if (rack::simd::movemask(nearXn2 & ~collinear)) {
+		const float_4 xMid = 0.5f * (x + xn2);
+		escape = ifelse(collinear, escape,
+			(2.0f/delta)*(foldFunctionN1(xMid) + (Fn1 - foldFunctionN2(xMid))/delta));
+	}
+
+	const float_4 y = ifelse(nearXn2,
+		escape,
+		2.0f * (Gn - Gn1)/(x - xn2));
+
+	// Update state variables
+	Fn1 = Fn;
+	Gn1 = Gn;
+	xn2 = xn1;
+	xn1 = x;
+
+	return y;
+}
+
+} // namespace Waveshaping
+
+class HardClipperSIMD {
+
+// ANTIALIASED HARD CLIPPER (FIRST-ORDER ANTIDERIVATIVE METHOD), SEE HardClipper
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	float_4 output = 0.0f;
+
+	float_4 xn1 = 0.0f;
+	float_4 Fn1 = 0.0f;
+
+public:
+
+	HardClipperSIMD() {}
+	~HardClipperSIMD() {}
+
+	void reset() {
+		output = 0.0f;
+		xn1 = 0.0f;
+		Fn1 = 0.0f;
+	}
+
+	void process(float_4 input) {
+		output = antialiasedHardClipN1(input);
+	}
+
+	inline float_4 antialiasedHardClipN1(float_4 x) {
+		using namespace Waveshaping;
+
+		// Hard clipping with 1st-order antialiasing
+		const float_4 Fn = hardClipN1(x);
+		const float_4 illConditioned = rack::simd::abs(x - xn1) < thresh;
+		const float_4 tmp = rack::simd::ifelse(illConditioned,
+			hardClipN0(0.5f * (x + xn1)),
+			(Fn - Fn1)/(x - xn1));
+
+		// Update states
+		xn1 = x;
+		Fn1 = Fn;
+
+		return tmp;
+	}
+
+	inline float_4 getClippedOutput() const noexcept {
+		return output;
+	}
+
+};
+
+class SoftClipperSIMD {
+
+// ANTIALIASED SOFT SATURATOR (FIRST-ORDER ANTIDERIVATIVE METHOD), SEE SoftClipper
+
+	using float_4 = rack::simd::float_4;
+
+private:
+
+	float_4 output = 0.0f;
+
+	float_4 xn1 = 0.0f;
+	float_4 Fn1 = Waveshaping::softClipN1(0.0f);
+
+public:
+
+	SoftClipperSIMD() {}
+	~SoftClipperSIMD() {}
+
+	void reset() {
+		output = 0.0f;
+		xn1 = 0.0f;
+		Fn1 = Waveshaping::softClipN1(0.0f);
+	}
+
+	void process(float_4 input) {
+		output = antialiasedSoftClipN1(input);
+	}
+
+	inline float_4 antialiasedSoftClipN1(float_4 x) {
+		using namespace Waveshaping;
+
+		// Soft clipping with 1st-order antialiasing
+		const float_4 Fn = softClipN1(x);
+		const float_4 illConditioned = rack::simd::abs(x - xn1) < softClipThresh;
+		float_4 tmp = (Fn - Fn1)/(x - xn1);
+		// The midpoint rule is rare with softClipThresh, so it is only evaluated when some lane takes it
+		if (rack::simd::movemask(illConditioned))
+			tmp = rack::simd::ifelse(illConditioned, softClipN0Midpoint(x, xn1), tmp);
+
+		// Update states
+		xn1 = x;
+		Fn1 = Fn;
+
+		return tmp;
+	}
+
+	inline float_4 getClippedOutput() const noexcept {
+		return output;
+	}
+
+};
+
+// ANTIALIASING ORDER OF THE FOLD CASCADE
+//   FOLD_NAIVE: THE FOLDING FUNCTION ITSELF (ALIASES HEAVILY, NO STATE)
+//   FOLD_ADAA1: FIRST-ORDER ANTIDERIVATIVE METHOD
+//   FOLD_ADAA2: SECOND-ORDER ANTIDERIVATIVE METHOD
+enum FoldAntialiasing {
+	FOLD_NAIVE,
+	FOLD_ADAA1,
+	FOLD_ADAA2
+};
+
+template <int N = 4>
+class FoldCascadeSIMD {
+
+// UP TO N FOLDING STAGES IN SERIES (SEE Wavefolder), FOUR VOICES AT A TIME. THE STATE IS
+// STORED STRUCT-OF-ARRAYS: EACH STATE VARIABLE OF ALL STAGES IS CONTIGUOUS, SO A GROUP'S WHOLE
+// CASCADE IS 64*N BYTES WITH NO PADDING. THE ANTIALIASING ORDER AND THE NUMBER OF STAGES RUN
+// ARE TEMPLATE PARAMETERS OF process(), WHICH IS UNROLLED AT COMPILE TIME, SO EACH COMBINATION
+// COMPILES TO ITS OWN STRAIGHT-LINE KERNEL AND THE COST SCALES WITH THE STAGES ACTUALLY RUN.
+// CALL reset() WHEN SWITCHING ORDERS OR STAGE COUNTS: Fn1 HOLDS A DIFFERENT ANTIDERIVATIVE IN
+// EACH ORDER, AND STAGES THAT WERE SKIPPED HOLD STALE STATE.
+//
+// INSIDE [-1 1] THE FOLDING FUNCTION IS THE IDENTITY AND ITS ANTIDERIVATIVES ARE x^2/2 AND
+// x^3/6, SO THE DIFFERENCE QUOTIENTS REDUCE EXACTLY TO MOVING AVERAGES: (x + xn1)/2 FOR
+// ADAA1 AND (x + xn1 + xn2)/3 FOR ADAA2. processLinear() COMPUTES ONLY THOSE, AND ONLY KEEPS
+// THE INPUT HISTORY; ITS CALLER MUST ENSURE THE INPUT AND THE STORED STATE (SEE statePeak())
+// STAY INSIDE [-1 1]. THE OUTPUTS ARE THEN CONVEX COMBINATIONS OF THE INPUTS, SO EVERY
+// STAGE STAYS INSIDE TOO. CALL syncState() BEFORE RETURNING TO process(): IT REBUILDS THE
+// ANTIDERIVATIVE STATE FROM THE INPUT HISTORY EXACTLY AS process() WOULD HAVE LEFT IT.
+
+	using float_4 = rack::simd::float_4;
+
+	static_assert(N >= 1 && N <= 8, "FoldCascadeSIMD supports 1 to 8 stages");
+
+public:
+
+	static constexpr int numStages = N;
+
+private:
+
+	// Antialiasing state variables, one float_4 per stage
+	float_4 xn1[N] = {};
+	float_4 xn2[N] = {};
+	float_4 Fn1[N] = {};
+	float_4 Gn1[N] = {};
+
+	template <int Order>
+	inline float_4 processStage(int i, float_4 x) noexcept {
+		if (Order == FOLD_ADAA2)
+			return Waveshaping::antialiasedFoldN2(x, xn1[i], xn2[i], Fn1[i], Gn1[i]);
+		else if (Order == FOLD_ADAA1)
+			return Waveshaping::antialiasedFoldN1(x, xn1[i], Fn1[i]);
+		else
+			return Waveshaping::foldFunctionN0(x);
+	}
+
+	// Stages I .. Stages-1, one instantiation per stage
+	template <int Order, int I, int Stages>
+	struct Unrolled {
+		static inline float_4 process(FoldCascadeSIMD& f, float_4 x) noexcept {
+			x = f.processStage<Order>(I, x);
+			return Unrolled<Order, I + 1, Stages>::process(f, x);
+		}
+	};
+
+	template <int Order, int Stages>
+	struct Unrolled<Order, Stages, Stages> {
+		static inline float_4 process(FoldCascadeSIMD&, float_4 x) noexcept {
+			return x;
+		}
+	};
+
+public:
+
+	FoldCascadeSIMD() {}
+	~FoldCascadeSIMD() {}
+
+	void reset() {
+		for (int i = 0; i < N; i++) {
+			xn1[i] = 0.0f;
+			xn2[i] = 0.0f;
+			Fn1[i] = 0.0f;
+			Gn1[i] = 0.0f;
+		}
+	}
+
+	template <int Order = FOLD_ADAA2, int Stages = N>
+	inline float_4 process(float_4 x) noexcept {
+		static_assert(Stages >= 1 && Stages <= N, "Stage count exceeds the cascade's capacity");
+		return Unrolled<Order, 0, Stages>::process(*this, x);
+	}
+
+	// Pass-through for inputs inside the linear region (see above)
+	template <int Order = FOLD_ADAA2, int Stages = N>
+	inline float_4 processLinear(float_4 x) noexcept {
+		static_assert(Stages >= 1 && Stages <= N, "Stage count exceeds the cascade's capacity");
+		for (int i = 0; i < Stages; i++) {
+			if (Order == FOLD_ADAA2) {
+				const float_4 y = (1.0f/3.0f) * (x + xn1[i] + xn2[i]);
+				xn2[i] = xn1[i];
+				xn1[i] = x;
+				x = y;
+			}
+			else if (Order == FOLD_ADAA1) {
+				const float_4 y = 0.5f * (x + xn1[i]);
+				xn1[i] = x;
+				x = y;
+			}
+		}
+		return x;
+	}
+
+	// Rebuild Fn1 and Gn1 from the input history after processLinear()
+	template <int Order = FOLD_ADAA2, int Stages = N>
+	void syncState() noexcept {
+		using namespace Waveshaping;
+		for (int i = 0; i < Stages; i++) {
+			if (Order == FOLD_ADAA2) {
+				const float_4 Fn2 = foldFunctionN2(xn2[i]);
+				Fn1[i] = foldFunctionN2(xn1[i]);
+				Gn1[i] = rack::simd::ifelse(rack::simd::abs(xn1[i] - xn2[i]) < thresh,
+					foldFunctionN1(0.5f * (xn1[i] + xn2[i])),
+					(Fn1[i] - Fn2) / (xn1[i] - xn2[i]));
+			}
+			else if (Order == FOLD_ADAA1) {
+				Fn1[i] = foldFunctionN1(xn1[i]);
+			}
+		}
+	}
+
+	// Largest stored input magnitude over the first Stages stages, per lane
+	template <int Stages = N>
+	float_4 statePeak() const noexcept {
+		float_4 peak = 0.0f;
+		for (int i = 0; i < Stages; i++)
+			peak = rack::simd::fmax(peak, rack::simd::fmax(rack::simd::abs(xn1[i]), rack::simd::abs(xn2[i])));
+		return peak;
+	}
+
+};
+
+#endif
@@ -0,0 +1,161 @@
+// SOFT CLIPPER AGAINST THE HARD CLIPPER: COST AND ACCURACY
+//
+// BOTH SATURATORS OF Fxld (HardClipperSIMD AND SoftClipperSIMD, SEE src/dsp/WaveshapingSIMD.hpp)
+// RUN 16 VOICES (FOUR float_4 GROUPS) ON THREE INPUTS, 1.5 V-PEAK SINES SCALED TO [-1 1] UNITS:
+//   slow sine: CONSECUTIVE SAMPLES CLOSE TOGETHER, SO MOSTLY THE MIDPOINT (ESCAPE) RULE
+//   fast sine: MOSTLY THE ANTIDERIVATIVE QUOTIENT
+//   fold:      THE OUTPUT OF A 4-STAGE FoldCascadeSIMD, AS IN Fxld, WHERE THE LANES DISAGREE
+// TIMES ARE THE BEST OF SEVERAL INTERLEAVED RUNS, IN ns PER SAMPLE FOR ALL 16 VOICES.
+//
+// THE SOFT CLIPPER IS ALSO CHECKED AGAINST THE SAME ANTIALIASED CLIPPER IN DOUBLE PRECISION
+// WITH THE EXACT sin AND cos (MUST STAY WITHIN maxError), ON THE THREE INPUTS AND ON RANDOM
+// PAIRS OF SAMPLES JUST OUTSIDE softClipThresh, WHERE THE DIFFERENCE QUOTIENT LOSES THE MOST
+// TO ROUNDING; AND THE SCALAR SoftClipper AGAINST THE float_4 ONE (MUST BE BIT-IDENTICAL).
+// THE PROGRAM EXITS NONZERO IF EITHER FAILS. TIMES ARE REPORTED, NOT CHECKED.
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "dsp/WaveshapingSIMD.hpp"
+
+namespace {
+
+using rack::simd::float_4;
+
+constexpr int numGroups = 4;
+constexpr int blockSize = 4096;
+constexpr int numSamples = 100000;
+constexpr int repetitions = 20;
+constexpr int numPairs = 4000000;
+
+// Kernel error (8.1e-5) plus the rounding of the quotient at the threshold
+constexpr double maxError = 1.2e-4;
+
+// The antialiased soft clipper of Waveshaping.hpp in double precision
+struct ReferenceSoftClipper {
+	double xn1 = 0.0;
+
+	static double n0(double x) {
+		return (std::fabs(x) < 1.0) ? std::sin(0.5*M_PI*x) : ((x > 0.0) ? 1.0 : -1.0);
+	}
+
+	static double n1(double x) {
+		return (std::fabs(x) < 1.0) ? 1.0 - (2.0/M_PI)*std::cos(0.5*M_PI*x) : std::fabs(x);
+	}
+
+	double process(double x) {
+		const double y = (std::fabs(x - xn1) < Waveshaping::softClipThresh) ? n0(0.5*(x + xn1)) : (n1(x) - n1(xn1))/(x - xn1);
+		xn1 = x;
+		return y;
+	}
+};
+
+enum Signal {
+	SIGNAL_SLOW,
+	SIGNAL_FAST,
+	SIGNAL_FOLD,
+	NUM_SIGNALS
+};
+
+const char* signalNames[NUM_SIGNALS] = {"slow sine", "fast sine", "fold"};
+
+float_4 inputs[blockSize][numGroups];
+
+void fill(Signal signal) {
+	FoldCascadeSIMD<4> folder;
+	for (int i = 0; i < blockSize; i++) {
+		for (int g = 0; g < numGroups; g++) {
+			for (int lane = 0; lane < 4; lane++) {
+				const int voice = 4*g + lane;
+				const float w = (signal == SIGNAL_SLOW) ? 0.0371f : 0.3f;
+				inputs[i][g][lane] = 1.5f*std::sin(i*w + voice) + 0.3f*std::sin(i*0.061f);
+			}
+		}
+		if (signal == SIGNAL_FOLD) {
+			// Differently offset folds, one per lane, shared by the groups (shifted in time)
+			const float_4 y = folder.process(float_4(5.0f*std::sin(i*0.0283f)) + float_4(0.0f, 0.3f, 0.6f, 0.9f));
+			for (int g = 0; g < numGroups; g++)
+				inputs[(i + 97*g) % blockSize][g] = y;
+		}
+	}
+}
+
+volatile float sink;
+
+// ns per sample for 16 voices
+template <typename Clipper>
+double run() {
+	Clipper clippers[numGroups];
+	float_4 sum = 0.0f;
+	const auto t0 = std::chrono::steady_clock::now();
+	for (int n = 0; n < numSamples; n++) {
+		for (int g = 0; g < numGroups; g++) {
+			clippers[g].process(inputs[n % blockSize][g]);
+			sum += clippers[g].getClippedOutput();
+		}
+	}
+	const auto t1 = std::chrono::steady_clock::now();
+	sink = sum[0] + sum[1] + sum[2] + sum[3];
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / numSamples;
+}
+
+bool measure(Signal signal) {
+	fill(signal);
+
+	double hard = 1e30, soft = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		hard = std::min(hard, run<HardClipperSIMD>());
+		soft = std::min(soft, run<SoftClipperSIMD>());
+	}
+
+	// Lane 0 of group 0, through the reference, the scalar and the float_4 clippers
+	ReferenceSoftClipper reference;
+	SoftClipper scalar;
+	SoftClipperSIMD vector;
+	double error = 0.0;
+	bool identical = true;
+	for (int n = 0; n < 4*blockSize; n++) {
+		const float x = inputs[n % blockSize][0][0];
+		scalar.process(x);
+		vector.process(float_4(x));
+		error = std::max(error, std::fabs(vector.getClippedOutput()[0] - reference.process(x)));
+		identical &= scalar.getClippedOutput() == vector.getClippedOutput()[0];
+	}
+
+	const bool ok = error <= maxError && identical;
+	printf("%-10s hard %5.1f ns  soft %5.1f ns (%3.0f%%)  max error %.1e  scalar %s  %s\n",
+		signalNames[signal], hard, soft, 100.0 * soft / hard, error,
+		identical ? "identical" : "DIFFERS", ok ? "OK" : "FAILED");
+	return ok;
+}
+
+// Pairs of samples between 1 and 3 thresholds apart, anywhere in [-1.5 1.5]
+bool measureThreshold() {
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> position(-1.5f, 1.5f), distance(1.0f, 3.0f);
+	double error = 0.0;
+	for (int i = 0; i < numPairs; i++) {
+		const float x0 = position(rng);
+		const float x1 = x0 + ((i & 1) ? 1.0f : -1.0f) * distance(rng) * Waveshaping::softClipThresh;
+		ReferenceSoftClipper reference;
+		SoftClipperSIMD vector;
+		reference.process(x0);
+		vector.process(float_4(x0));
+		vector.process(float_4(x1));
+		error = std::max(error, std::fabs(vector.getClippedOutput()[0] - reference.process(x1)));
+	}
+
+	const bool ok = error <= maxError;
+	printf("threshold  max error %.1e  %s\n", error, ok ? "OK" : "FAILED");
+	return ok;
+}
+
+} // namespace
+
+int main() {
+	bool ok = true;
+	for (int s = 0; s < NUM_SIGNALS; s++)
+		ok &= measure((Signal) s);
+	ok &= measureThreshold();
+	return ok ? 0 : 1;
+}
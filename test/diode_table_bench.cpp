@@ -0,0 +1,110 @@
+// SHARED DIODE TABLE AGAINST PER-INSTANCE TABLES: CONSTRUCTION TIME AND MEMORY
+//
+// BEFORE LookupTables::DiodeKernel EVERY MS20Filter HELD ITS OWN 10001-ENTRY diodeDrop AND
+// diodeDropDx ARRAYS, COPIED FROM THE LITERAL INITIALISERS WHENEVER A FILTER WAS CONSTRUCTED.
+// PerInstanceMS20 BELOW KEEPS THAT LAYOUT (THE TABLES ARE SAMPLED FROM THE KERNEL INSTEAD OF
+// PASTED IN, WHICH DOESN'T CHANGE THE COST OF THE COPY). FOR A GROWING NUMBER OF MS20VCF
+// MODULES (16 FILTERS EACH) THE PROGRAM CONSTRUCTS THAT MANY FILTERS BOTH WAYS AND REPORTS
+// THE TIME AND THE BYTES THEY HOLD; THE SHARED CASE ALSO PAYS FOR BUILDING THE KERNEL ONCE.
+// TIMES ARE THE BEST OF SEVERAL RUNS AND INCLUDE THE PAGE FAULTS ON FRESHLY ALLOCATED MEMORY.
+//
+// THE SHARED LAYOUT MUST USE LESS MEMORY FOR EVERY COUNT; THE PROGRAM EXITS NONZERO IF IT
+// DOESN'T. TIMES ARE REPORTED, NOT CHECKED.
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#include "dsp/MS20Filter.hpp"
+
+namespace {
+
+constexpr int tableSize = 10001;
+constexpr int filtersPerModule = 16;
+constexpr int repetitions = 5;
+
+// Stands in for the literal tables of the old header, which lived in .rodata
+struct ReferenceTables {
+	std::array<float, tableSize> drop, dropDx;
+
+	ReferenceTables() {
+		const LookupTables::DiodeKernel& diode = LookupTables::diodeKernel();
+		for (int i = 0; i < tableSize; i++)
+			drop[i] = diode.process(i * 1.0e-3f, dropDx[i]);
+	}
+};
+
+const ReferenceTables& referenceTables() {
+	static const ReferenceTables tables;
+	return tables;
+}
+
+// The old MS20Filter, down to its tables and state
+class PerInstanceMS20 {
+	const std::array<float, tableSize> diodeDrop = referenceTables().drop;
+	const std::array<float, tableSize> diodeDropDx = referenceTables().dropDx;
+
+	float state[16] = {};
+
+public:
+	float probe(int i) const {
+		return diodeDrop[i] + diodeDropDx[i] + state[0];
+	}
+};
+
+volatile float sink;
+
+// Constructs n filters on the heap and returns the time taken, in ms
+template <typename Filter>
+double construct(int n) {
+	double best = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		const auto t0 = std::chrono::steady_clock::now();
+		Filter* filters = new Filter[n];
+		const auto t1 = std::chrono::steady_clock::now();
+		// Keeps the construction from being optimised away
+		sink = sizeof(filters[n-1]) + *reinterpret_cast<const volatile unsigned char*>(&filters[n-1]);
+		delete[] filters;
+		best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+	}
+	return best;
+}
+
+// Builds the shared kernel from scratch, as the first filter (or init()) does, in ms
+double buildKernel() {
+	double best = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		const auto t0 = std::chrono::steady_clock::now();
+		LookupTables::DiodeKernel* kernel = new LookupTables::DiodeKernel;
+		const auto t1 = std::chrono::steady_clock::now();
+		float slope;
+		sink = kernel->process(1.0f, slope);
+		delete kernel;
+		best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+	}
+	return best;
+}
+
+} // namespace
+
+int main() {
+	referenceTables();
+	const double kernelMs = buildKernel();
+
+	printf("per-instance filter %zu bytes, shared filter %zu bytes, shared kernel %zu bytes (built in %.3f ms)\n",
+		sizeof(PerInstanceMS20), sizeof(MS20Filter), sizeof(LookupTables::DiodeKernel), kernelMs);
+
+	bool ok = true;
+	for (int modules : {1, 4, 16, 64}) {
+		const int n = modules * filtersPerModule;
+		const double perInstanceMs = construct<PerInstanceMS20>(n);
+		const double sharedMs = construct<MS20Filter>(n) + kernelMs;
+		const size_t perInstanceBytes = n * sizeof(PerInstanceMS20);
+		const size_t sharedBytes = n * sizeof(MS20Filter) + sizeof(LookupTables::DiodeKernel);
+		const bool smaller = sharedBytes < perInstanceBytes;
+		ok &= smaller;
+		printf("%3d modules (%4d filters)  per-instance %8.3f ms %9zu bytes  shared %8.3f ms %7zu bytes  %s\n",
+			modules, n, perInstanceMs, perInstanceBytes, sharedMs, sharedBytes, smaller ? "OK" : "FAILED");
+	}
+	return ok ? 0 : 1;
+}
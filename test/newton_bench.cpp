@@ -0,0 +1,239 @@
+// Newton::Solver AGAINST THE HAND-WRITTEN MS20 SOLVER IT REPLACED
+//
+// HandWrittenMS20 BELOW IS THE 2x2 NEWTON LOOP MS20FilterSIMD USED BEFORE Newton.hpp (SAME
+// WARM START, DAMPING, CHORD REFRESH AND TELEMETRY), KEPT HERE AS THE REFERENCE. BOTH RUN 16
+// VOICES (FOUR float_4 GROUPS) AT 48 kHz ON SAWTOOTHS, CUTOFFS 300 Hz - 8 kHz, ONE SECOND PER
+// RUN, FOR EVERY SOLVER POLICY WITH THE PADE tanh AND FOR NEWTON WITH THE EXACT tanh. TIMES
+// ARE THE BEST OF SEVERAL INTERLEAVED RUNS, IN ns PER SAMPLE FOR ALL 16 VOICES.
+//
+// THE OUTPUTS MUST BE BIT-IDENTICAL; THE PROGRAM EXITS NONZERO IF THEY AREN'T. IT IS BUILT
+// WITHOUT -fassociative-math (SEE THE Makefile), SINCE REGROUPING THE ARITHMETIC OF TWO
+// DIFFERENT SOURCES NEED NOT GIVE THE SAME ROUNDING: WITH RACK'S FULL FLAGS THE CHORD SOLVER
+// DIFFERS BY UP TO 3.1e-7 (k = 0.5) AND 2.6e-5 (k = 1.5), THE OTHER SOLVERS NOT AT ALL.
+#include <chrono>
+#include <cstdio>
+
+#include "dsp/MS20FilterSIMD.hpp"
+
+namespace {
+
+using rack::simd::float_4;
+using rack::simd::int32_4;
+
+class HandWrittenMS20 {
+
+	typedef MS20FilterSIMD Model;
+
+	float_4 output = 0.0f;
+	float piT = M_PI/44100.0f;
+
+	const FastMath::DiodeSpline diodeFeedback;
+	const float alpha = 0.405246f;
+	const float beta = 0.413969f;
+
+	float_4 V_n[2] = {0.0f, 0.0f};
+	float_4 V_n1[2] = {0.0f, 0.0f};
+	float_4 V_n2[2] = {0.0f, 0.0f};
+	float_4 V_n3[2] = {0.0f, 0.0f};
+	float_4 tanh_a1_n1 = 0.0f;
+	float_4 tanh_a2_n1 = 0.0f;
+	float_4 Jinv[2][2] = {{1.0f, 0.0f}, {0.0f, 1.0f}};
+
+	float_4 k = 0.0f;
+	float_4 half_T_wc = 0.0f;
+	float_4 half_T_wc_alpha = 0.0f;
+	float_4 half_T_wc_beta = 0.0f;
+
+	inline void invertJacobian(float_4 sech2_a1, float_4 sech2_a2, float_4 kdFeedback, float_4 (&inv)[2][2]) const noexcept {
+		const float_4 J00 = 1.0f + half_T_wc_alpha*sech2_a1;
+		const float_4 J01 = half_T_wc_alpha*sech2_a1*kdFeedback;
+		const float_4 J10 = -half_T_wc_beta*sech2_a2;
+		const float_4 J11 = 1.0f - half_T_wc_beta*sech2_a2*(kdFeedback - 1.0f);
+
+		const float_4 one_det = 1.0f/(J00*J11 - J01*J10);
+		inv[0][0] = one_det*J11;
+		inv[0][1] = -one_det*J01;
+		inv[1][0] = -one_det*J10;
+		inv[1][1] = one_det*J00;
+	}
+
+public:
+
+	uint32_t histogram[4][Model::maxIterations + 1] = {};
+	int32_4 nonConverged = 0;
+	float_4 largestFinalStep = 0.0f;
+
+	void setSampleRate(float SR) {
+		piT = M_PI/SR;
+	}
+
+	void setParams(float_4 fc, float_4 resonance) {
+		k = resonance;
+		const float_4 theta = rack::simd::fmin(piT*fc, 1.5f);
+		half_T_wc = FastMath::tan(theta) * (1.0f/alpha);
+		half_T_wc_alpha = half_T_wc * alpha;
+		half_T_wc_beta = half_T_wc * beta;
+	}
+
+	template <typename Tanh, typename Solver>
+	void process(float_4 Vin) {
+		const Tanh tanh;
+
+		float_4 tanh_a1_n = tanh_a1_n1;
+		float_4 tanh_a2_n = tanh_a2_n1;
+
+		if (Solver::extrapolate) {
+			V_n[0] = 3.0f*(V_n1[0] - V_n2[0]) + V_n3[0];
+			V_n[1] = 3.0f*(V_n1[1] - V_n2[1]) + V_n3[1];
+		}
+		else {
+			V_n[0] = V_n1[0];
+			V_n[1] = V_n1[1];
+		}
+
+		float_4 active = float_4::mask();
+		float_4 iterations = 0.0f;
+		float_4 residual = 0.0f;
+		float_4 sech2_a1, sech2_a2, kdFeedback;
+
+		for (int i = 0; i < Solver::iterations; i++) {
+			iterations += 1.0f & active;
+
+			const float_4 kV = k*V_n[1];
+			float_4 dxFeedbackNL_n;
+			const float_4 feedbackNL_n = diodeFeedback(rack::simd::abs(kV), dxFeedbackNL_n);
+			kdFeedback = k*dxFeedbackNL_n*rack::simd::sgn(kV);
+			if (i >= Solver::fullSteps)
+				kdFeedback = rack::simd::fmin(kdFeedback, 0.0f);
+
+			const float_4 a1_n = alpha*(Vin - V_n[0] - feedbackNL_n);
+			const float_4 a2_n = beta*(V_n[0] - V_n[1] + feedbackNL_n);
+
+			const float_4 tanh_a1 = tanh(a1_n);
+			const float_4 tanh_a2 = tanh(a2_n);
+			sech2_a1 = 1.0f - tanh_a1*tanh_a1;
+			sech2_a2 = 1.0f - tanh_a2*tanh_a2;
+
+			const float_4 F0 = V_n[0] - V_n1[0] - half_T_wc*(tanh_a1 + tanh_a1_n1);
+			const float_4 F1 = V_n[1] - V_n1[1] - half_T_wc*(tanh_a2 + tanh_a2_n1);
+
+			float_4 inv[2][2];
+			if (Solver::chord) {
+				inv[0][0] = Jinv[0][0];
+				inv[0][1] = Jinv[0][1];
+				inv[1][0] = Jinv[1][0];
+				inv[1][1] = Jinv[1][1];
+			}
+			else {
+				invertJacobian(sech2_a1, sech2_a2, kdFeedback, inv);
+			}
+			const float_4 delta0 = inv[0][0]*F0 + inv[0][1]*F1;
+			const float_4 delta1 = inv[1][0]*F0 + inv[1][1]*F1;
+
+			V_n[0] -= delta0 & active;
+			V_n[1] -= delta1 & active;
+			tanh_a1_n = rack::simd::ifelse(active, tanh_a1, tanh_a1_n);
+			tanh_a2_n = rack::simd::ifelse(active, tanh_a2, tanh_a2_n);
+
+			const float_4 step = rack::simd::abs(delta0) + rack::simd::abs(delta1);
+			residual = rack::simd::ifelse(active, step, residual);
+			active &= step >= Model::tolerance;
+			if (Solver::earlyExit && rack::simd::movemask(active) == 0)
+				break;
+		}
+
+		if (Solver::chord)
+			invertJacobian(sech2_a1, sech2_a2, kdFeedback, Jinv);
+
+		const int32_4 iterationCount = int32_4(iterations);
+		for (int lane = 0; lane < 4; lane++)
+			histogram[lane][iterationCount[lane]]++;
+		nonConverged = _mm_sub_epi32(nonConverged.v, _mm_castps_si128(active.v));
+		largestFinalStep = rack::simd::fmax(largestFinalStep, residual);
+
+		output = V_n[1];
+
+		V_n3[0] = V_n2[0];
+		V_n3[1] = V_n2[1];
+		V_n2[0] = V_n1[0];
+		V_n2[1] = V_n1[1];
+		V_n1[0] = V_n[0];
+		V_n1[1] = V_n[1];
+		tanh_a1_n1 = tanh_a1_n;
+		tanh_a2_n1 = tanh_a2_n;
+	}
+
+	inline float_4 getOutput() const noexcept {
+		return output;
+	}
+};
+
+constexpr float sampleRate = 48000.0f;
+constexpr int numSamples = 48000;
+constexpr int numGroups = 4;
+constexpr int repetitions = 5;
+
+// Runs numSamples through fresh filters, storing every output, and returns ns per sample
+template <typename Filter, typename Tanh, typename Solver>
+double run(float resonance, float_4* outputs) {
+	Filter filters[numGroups];
+	float_4 phase[numGroups], increment[numGroups], cutoff[numGroups];
+	for (int g = 0; g < numGroups; g++) {
+		filters[g].setSampleRate(sampleRate);
+		for (int lane = 0; lane < 4; lane++) {
+			const int voice = 4*g + lane;
+			phase[g][lane] = 0.0f;
+			increment[g][lane] = (55.0f + 13.0f*voice) / sampleRate;
+			cutoff[g][lane] = 300.0f * std::pow(1.25f, (float) voice);
+		}
+	}
+
+	const auto t0 = std::chrono::steady_clock::now();
+	for (int n = 0; n < numSamples; n++) {
+		for (int g = 0; g < numGroups; g++) {
+			phase[g] += increment[g];
+			phase[g] -= rack::simd::floor(phase[g]);
+			filters[g].setParams(cutoff[g], float_4(resonance));
+			filters[g].template process<Tanh, Solver>(2.0f*phase[g] - 1.0f);
+			outputs[n*numGroups + g] = filters[g].getOutput();
+		}
+	}
+	const auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / numSamples;
+}
+
+float_4 handOutputs[numSamples*numGroups];
+float_4 frameworkOutputs[numSamples*numGroups];
+
+template <typename Tanh, typename Solver>
+bool compare(const char* name, float resonance) {
+	double hand = 1e30, framework = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		hand = std::min(hand, run<HandWrittenMS20, Tanh, Solver>(resonance, handOutputs));
+		framework = std::min(framework, run<MS20FilterSIMD, Tanh, Solver>(resonance, frameworkOutputs));
+	}
+	float maxDiff = 0.0f;
+	for (int i = 0; i < numSamples*numGroups; i++) {
+		for (int lane = 0; lane < 4; lane++)
+			maxDiff = std::max(maxDiff, std::fabs(handOutputs[i][lane] - frameworkOutputs[i][lane]));
+	}
+	const bool ok = maxDiff == 0.0f;
+	printf("k = %.1f  %-14s hand-written %6.0f ns  framework %6.0f ns  max diff %.1e  %s\n",
+		resonance, name, hand, framework, maxDiff, ok ? "OK" : "FAILED");
+	return ok;
+}
+
+} // namespace
+
+int main() {
+	typedef MS20FilterSIMD M;
+	bool ok = true;
+	for (float k : {0.5f, 1.5f}) {
+		ok &= compare<FastMath::TanhPade, M::NewtonSolver>("newton", k);
+		ok &= compare<FastMath::TanhPade, M::FixedNewtonSolver>("fixed", k);
+		ok &= compare<FastMath::TanhPade, M::ChordSolver>("chord", k);
+		ok &= compare<FastMath::TanhPade, M::SemiImplicitSolver>("semi-implicit", k);
+		ok &= compare<FastMath::TanhExact, M::NewtonSolver>("newton, exact", k);
+	}
+	return ok ? 0 : 1;
+}
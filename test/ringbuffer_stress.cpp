@@ -0,0 +1,127 @@
+// TWO-THREAD STRESS TEST FOR SPSCRingBuffer (SEE src/dsp/RingBuffer.hpp)
+//
+// A PRODUCER THREAD, STANDING IN FOR THE AUDIO THREAD, PUSHES NUMBERED RECORDS WHILE A CONSUMER
+// THREAD, STANDING IN FOR THE UI, POPS THEM. EACH RECORD CARRIES ITS SEQUENCE NUMBER IN EVERY
+// FIELD (SCRAMBLED DIFFERENTLY), SO A RECORD READ WHILE HALF WRITTEN SHOWS UP AS TORN. THREE RUNS:
+//   live:    THE CONSUMER POPS AS FAST AS IT CAN
+//   slow:    THE CONSUMER SLEEPS BETWEEN BATCHES, SO THE BUFFER FILLS AND push() DROPS
+//   stalled: THE CONSUMER ONLY STARTS ONCE THE PRODUCER IS DONE. IF push() EVER WAITED FOR
+//            SPACE THIS RUN WOULD NEVER FINISH
+// EVERY RUN CHECKS THAT NO RECORD IS TORN, THAT RECORDS ARRIVE IN ORDER, AND THAT EVERY PUSH
+// IS ACCOUNTED FOR (POPPED OR REPORTED AS DROPPED). THE PRODUCER ALSO TIMES EVERY push(); THE
+// WORST CASE IS REPORTED, NOT CHECKED, SINCE A PREEMPTED THREAD CAN TAKE ANY TIME.
+//
+// USAGE: ringbuffer_stress [pushes per run, default 50000000]. EXITS NONZERO ON A FAILURE.
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "dsp/RingBuffer.hpp"
+
+namespace {
+
+struct Record {
+	uint32_t sequence;
+	uint32_t times3;
+	uint32_t scrambled;
+	uint32_t inverted;
+};
+
+// Same size and alignment as the telemetry frames of Fxld
+typedef SPSCRingBuffer<Record, 256> Buffer;
+
+enum Consumer {
+	CONSUMER_LIVE,
+	CONSUMER_SLOW,
+	CONSUMER_STALLED
+};
+
+const char* consumerNames[] = {"live", "slow", "stalled"};
+
+struct Report {
+	uint32_t dropped = 0;
+	uint32_t popped = 0;
+	uint32_t torn = 0;
+	uint32_t outOfOrder = 0;
+	double worstPushNs = 0.0;
+	double meanPushNs = 0.0;
+};
+
+bool runTest(Consumer consumer, uint32_t pushes) {
+	Buffer* buffer = new Buffer;
+	std::atomic<bool> producerDone{false};
+	Report report;
+
+	std::thread producer([&] {
+		double total = 0.0;
+		for (uint32_t i = 0; i < pushes; i++) {
+			const Record r = {i, i*3u, i ^ 0xdeadbeefu, ~i};
+			const auto t0 = std::chrono::steady_clock::now();
+			const bool pushed = buffer->push(r);
+			const auto t1 = std::chrono::steady_clock::now();
+			const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+			total += ns;
+			if (ns > report.worstPushNs)
+				report.worstPushNs = ns;
+			if (!pushed)
+				report.dropped++;
+			// Gives a consumer sharing the core a chance to run, like the gaps between
+			// audio blocks
+			if (consumer != CONSUMER_STALLED && (i & 255) == 0)
+				std::this_thread::yield();
+		}
+		report.meanPushNs = total / pushes;
+		producerDone = true;
+	});
+
+	if (consumer == CONSUMER_STALLED) {
+		while (!producerDone)
+			std::this_thread::yield();
+	}
+
+	bool first = true;
+	uint32_t last = 0;
+	Record r;
+	while (true) {
+		if (buffer->pop(r)) {
+			report.popped++;
+			if (r.times3 != r.sequence*3u || r.scrambled != (r.sequence ^ 0xdeadbeefu) || r.inverted != ~r.sequence)
+				report.torn++;
+			if (!first && r.sequence <= last)
+				report.outOfOrder++;
+			last = r.sequence;
+			first = false;
+			if (consumer == CONSUMER_SLOW && (report.popped % 64) == 0)
+				std::this_thread::sleep_for(std::chrono::microseconds(100));
+		}
+		else if (producerDone && buffer->size() == 0) {
+			break;
+		}
+		else {
+			// Lets the producer run on a single core
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+	delete buffer;
+
+	const bool ok = report.torn == 0 && report.outOfOrder == 0 && report.popped + report.dropped == pushes;
+	printf("%-8s pushed %u, popped %u, dropped %u, torn %u, out of order %u, push mean %.1f ns, worst %.0f ns  %s\n",
+		consumerNames[consumer], pushes, report.popped, report.dropped, report.torn, report.outOfOrder,
+		report.meanPushNs, report.worstPushNs, ok ? "OK" : "FAILED");
+	return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+	const uint32_t pushes = (argc > 1) ? (uint32_t) std::strtoul(argv[1], nullptr, 10) : 50000000u;
+
+	bool ok = true;
+	ok &= runTest(CONSUMER_LIVE, pushes);
+	ok &= runTest(CONSUMER_SLOW, pushes / 10);
+	ok &= runTest(CONSUMER_STALLED, pushes);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// tanh KERNELS OF FastMath.hpp AGAINST std::tanh: ACCURACY AND THROUGHPUT
+//
+// FOR EVERY KERNEL (EXACT, PADE, POLYNOMIAL, SPLINE), SCALAR AND float_4 FORMS, THE PROGRAM
+// MEASURES THE MAX ABSOLUTE ERROR AGAINST std::tanh IN DOUBLE PRECISION OVER A DENSE GRID ON
+// [-8, 8], AND THE TIME PER VALUE OVER A BLOCK OF INPUTS SPREAD OVER THE RANGE THE MS20 SOLVER
+// SEES. TIMES ARE THE BEST OF SEVERAL RUNS; std::tanh ITSELF IS THE BASELINE.
+//
+// THE ERRORS MUST STAY WITHIN THE BOUNDS DOCUMENTED IN FastMath.hpp; THE PROGRAM EXITS NONZERO
+// IF ONE DOESN'T. TIMES ARE REPORTED, NOT CHECKED.
+#include <chrono>
+#include <cstdio>
+
+#include "dsp/FastMath.hpp"
+
+namespace {
+
+using rack::simd::float_4;
+
+constexpr float range = 8.0f;
+constexpr int gridSize = 1 << 22;
+constexpr int blockSize = 4096;
+constexpr int passes = 2000;
+constexpr int repetitions = 5;
+
+float inputs[blockSize];
+
+// Max error over the grid, scalar or vector form
+template <typename Tanh>
+double scalarError() {
+	const Tanh tanh;
+	double worst = 0.0;
+	for (int i = 0; i <= gridSize; i++) {
+		const float x = -range + 2.0f * range * i / gridSize;
+		worst = std::max(worst, std::abs(tanh(x) - std::tanh((double) x)));
+	}
+	return worst;
+}
+
+template <typename Tanh>
+double vectorError() {
+	const Tanh tanh;
+	double worst = 0.0;
+	for (int i = 0; i <= gridSize; i += 4) {
+		float_4 x;
+		for (int lane = 0; lane < 4; lane++)
+			x[lane] = -range + 2.0f * range * (i + lane) / gridSize;
+		const float_4 y = tanh(x);
+		for (int lane = 0; lane < 4; lane++)
+			worst = std::max(worst, std::abs(y[lane] - std::tanh((double) x[lane])));
+	}
+	return worst;
+}
+
+volatile float sink;
+
+// ns per value
+template <typename Tanh>
+double scalarTime() {
+	const Tanh tanh;
+	double best = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		float sum = 0.0f;
+		const auto t0 = std::chrono::steady_clock::now();
+		for (int p = 0; p < passes; p++) {
+			for (int i = 0; i < blockSize; i++)
+				sum += tanh(inputs[i]);
+			// Stops the compiler from computing one pass and reusing it
+			asm volatile("" ::: "memory");
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		sink = sum;
+		best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double) passes * blockSize));
+	}
+	return best;
+}
+
+template <typename Tanh>
+double vectorTime() {
+	const Tanh tanh;
+	double best = 1e30;
+	for (int r = 0; r < repetitions; r++) {
+		float_4 sum = 0.0f;
+		const auto t0 = std::chrono::steady_clock::now();
+		for (int p = 0; p < passes; p++) {
+			for (int i = 0; i < blockSize; i += 4)
+				sum += tanh(float_4::load(&inputs[i]));
+			// Stops the compiler from computing one pass and reusing it
+			asm volatile("" ::: "memory");
+		}
+		const auto t1 = std::chrono::steady_clock::now();
+		sink = sum[0] + sum[1] + sum[2] + sum[3];
+		best = std::min(best, std::chrono::duration<double, std::nano>(t1 - t0).count() / ((double) passes * blockSize));
+	}
+	return best;
+}
+
+struct StdTanh {
+	inline float operator()(float x) const noexcept {
+		return std::tanh(x);
+	}
+};
+
+template <typename Tanh>
+bool measure(const char* name, double scalarBound, double vectorBound, double baseline) {
+	const double errors[2] = {scalarError<Tanh>(), vectorError<Tanh>()};
+	const double times[2] = {scalarTime<Tanh>(), vectorTime<Tanh>()};
+	const double bounds[2] = {scalarBound, vectorBound};
+	const char* forms[2] = {"float", "float_4"};
+
+	bool ok = true;
+	for (int f = 0; f < 2; f++) {
+		const bool within = errors[f] <= bounds[f];
+		ok &= within;
+		printf("%-10s %-7s  max error %.3e (bound %.1e)  %5.2f ns/value  %4.1fx std::tanh  %s\n",
+			name, forms[f], errors[f], bounds[f], times[f], baseline / times[f], within ? "OK" : "FAILED");
+	}
+	return ok;
+}
+
+} // namespace
+
+int main() {
+	// The arguments of the MS20 tanh stages stay within a few volts
+	for (int i = 0; i < blockSize; i++)
+		inputs[i] = -5.0f + 10.0f * ((i * 2654435761u) % blockSize) / blockSize;
+
+	const double baseline = scalarTime<StdTanh>();
+	printf("std::tanh  float    %5.2f ns/value\n", baseline);
+
+	bool ok = true;
+	ok &= measure<FastMath::TanhExact>("exact", 1.1e-7, 1.8e-7, baseline);
+	ok &= measure<FastMath::TanhPade>("pade", 9.6e-5, 9.6e-5, baseline);
+	ok &= measure<FastMath::TanhPolynomial>("polynomial", 5.0e-3, 5.0e-3, baseline);
+	ok &= measure<FastMath::TanhSpline>("spline", 2.7e-6, 2.7e-6, baseline);
+	return ok ? 0 : 1;
+}